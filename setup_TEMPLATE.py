@@ -26,6 +26,8 @@ ext_modules = [
             get_pybind_include(),
             get_pybind_include(user=True)
         ],
+        # zlib, to read midi files from archives
+        libraries=['z'],
         #headers=$HPP_PATHS,
         language='c++'
     ),
@@ -86,6 +88,9 @@ class BuildExt(build_ext):
             opts.append(cpp_flag(self.compiler))
             if has_flag(self.compiler, '-fvisibility=hidden'):
                 opts.append('-fvisibility=hidden')
+            if has_flag(self.compiler, '-pthread'):
+                opts.append('-pthread')
+                link_opts.append('-pthread')
         elif ct == 'msvc':
             opts.append('/DVERSION_INFO=\\"%s\\"' % self.distribution.get_version())
         for ext in self.extensions:
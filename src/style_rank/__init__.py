@@ -1 +1 @@
-from style_rank.api import get_features, get_similarity_matrix, get_feature_csv, get_feature_names, rank
\ No newline at end of file
+from style_rank.api import get_features, get_note_features, iter_features, get_similarity_matrix, get_feature_csv, get_feature_names, rank, enable_cache, disable_cache, cache_stats, stream_report, save_vocabulary, load_vocabulary, enable_feature_store, disable_feature_store, compact_feature_store, feature_store_stats
\ No newline at end of file
@@ -2,6 +2,7 @@ import os
 import csv
 import json
 import numpy as np
+import scipy.sparse
 import warnings
 from scipy.stats import rankdata
 from subprocess import call
@@ -10,11 +11,72 @@ from sklearn.metrics.pairwise import cosine_distances
 from sklearn.preprocessing import OneHotEncoder
 
 # import c++ code
-from ._style_rank import get_features_internal, get_feature_names_internal
+from ._style_rank import get_features_internal, get_note_features_internal, get_feature_names_internal, rf_leaves_internal
+from ._style_rank import enable_cache_internal, disable_cache_internal, cache_stats_internal
+from ._style_rank import stream_report_internal, iter_features_internal
+from ._style_rank import enable_feature_store_internal, disable_feature_store_internal, compact_feature_store_internal, feature_store_stats_internal
 
 def get_feature_names(tag="ORIGINAL"):
 	return get_feature_names_internal(tag)
 
+def enable_cache(cache_dir, max_bytes=2**30, store_chords=True):
+	"""cache parsed midis on disk, so that later calls (in this or any other process using the same cache_dir) skip parsing unchanged files.
+
+	Entries are keyed by the content of each midi file, the resolution and include_offsets. Once the cache is larger than max_bytes, the least recently used entries are removed.
+
+	Args:
+		cache_dir (str): the directory in which to store the cache. It is created if it does not exist.
+		max_bytes (int): the maximum size of the cache on disk.
+		store_chords (bool): a boolean flag indicating if chord segmentations are cached along with the notes.
+	"""
+	if not os.path.isdir(cache_dir):
+		os.makedirs(cache_dir)
+	enable_cache_internal(cache_dir, max_bytes, store_chords)
+
+def disable_cache():
+	"""stop using the parsed midi cache. The files on disk are left in place."""
+	disable_cache_internal()
+
+def cache_stats():
+	"""statistics for the parsed midi cache since it was enabled.
+
+	Returns:
+		dict: the number of hits, misses, writes and evictions, and the size of the cache in bytes. Empty if the cache is not enabled.
+	"""
+	return cache_stats_internal()
+
+def enable_feature_store(store_dir):
+	"""store the distributions of every featurized midi in an append-only log, so that later calls (in this or any other process using the same store_dir) only featurize files that are new or have changed.
+
+	Records are keyed by the path, modification time and size of each midi file, the resolution and include_offsets. Several processes may read and append to the same store at once.
+
+	Args:
+		store_dir (str): the directory in which to store the log. It is created if it does not exist.
+	"""
+	if not os.path.isdir(store_dir):
+		os.makedirs(store_dir)
+	enable_feature_store_internal(store_dir)
+
+def disable_feature_store():
+	"""stop using the feature store. The log on disk is left in place."""
+	disable_feature_store_internal()
+
+def compact_feature_store():
+	"""rewrite the feature store without superseded records and records of files that have changed or been removed.
+
+	Returns:
+		int: the number of bytes removed from the log.
+	"""
+	return compact_feature_store_internal()
+
+def feature_store_stats():
+	"""statistics for the feature store since it was enabled.
+
+	Returns:
+		dict: the number of hits, misses and appends, the number of records and the size of the log in bytes. Empty if the feature store is not enabled.
+	"""
+	return feature_store_stats_internal()
+
 # checking arguments ...
 def validate_argument(x, name):
 	class domain:
@@ -72,31 +134,50 @@ def validate_features(paths, labels, features):
 
 		paths (list): a list of midi filepaths.
 		labels (list): a list of integers on the range [0,1].
-		features (dict): a dictionary containing one or more features.
+		features (dict): a dictionary containing one or more features (np.ndarray or scipy.sparse matrices).
 	"""
 	if not type(features) == dict:
 		raise TypeError('Provided features are not a dictionary')
 	if len(features) == 0:
 		raise Exception('Provided features are empty')
-	is_numpy = np.all([type(v) == np.ndarray for v in features.values()])
-	is_size = np.all([len(v) == len(paths) for v in features.values()])
+	is_numpy = np.all([type(v) == np.ndarray or scipy.sparse.issparse(v) for v in features.values()])
+	is_size = is_numpy and np.all([v.shape[0] == len(paths) for v in features.values()])
 	if not is_numpy or not is_size:
 		raise Exception('Each feature must be a matrix of size (len(paths),d)')
 
+# midi files held in memory
+MIDI_BUFFER_TYPES = (bytes, bytearray, memoryview)
+
+ARCHIVE_EXTENSIONS = (".zip", ".tar", ".tar.gz", ".tgz")
+
+def is_archive(path):
+	return isinstance(path, str) and path.lower().endswith(ARCHIVE_EXTENSIONS)
+
 def validate_paths(paths, list_name=None):
 	"""ensure that paths are well formed.
 
 	Args:
-		paths (list): a list of midi filepaths
+		paths (list): a list of midi filepaths, archives of midi files (.zip, .tar, .tar.gz or .tgz), and/or midi files held in memory (bytes, bytearray or memoryview)
 		list_name (str): an identifier for the paths list
+
+	Returns:
+		paths (np.ndarray): the valid paths. An object array if any are held in memory, so that they are not copied.
+		indices (np.ndarray): the index of each valid path in paths.
 	"""
+	if isinstance(paths, MIDI_BUFFER_TYPES):
+		paths = [paths]
+	elif not isinstance(paths, (list, tuple)):
+		paths = np.atleast_1d(paths)
 	valid_paths = []
 	indices = []
-	for i,path in enumerate(np.atleast_1d(paths)):
-		if not os.path.exists(path):
+	for i,path in enumerate(paths):
+		if isinstance(path, MIDI_BUFFER_TYPES):
+			valid_paths.append(path)
+			indices.append(i)
+		elif not os.path.exists(path):
 			warnings.warn('{} does not exist.'.format(path))
-		elif not path.endswith(".mid"):
-			warnings.warn('{} if not a MIDI file (.mid).'.format(path))
+		elif not path.endswith(".mid") and not is_archive(path):
+			warnings.warn('{} if not a MIDI file (.mid) or an archive ({}).'.format(path, ", ".join(ARCHIVE_EXTENSIONS)))
 		else:
 			valid_paths.append(path)
 			indices.append(i)
@@ -104,56 +185,273 @@ def validate_paths(paths, list_name=None):
 		if list_name is not None:
 			raise Exception('No valid filepaths provided in {}'.format(list_name))
 		raise Exception('No valid filepaths provided')
+	if any(isinstance(path, MIDI_BUFFER_TYPES) for path in valid_paths):
+		buffers = np.empty(len(valid_paths), dtype=object)
+		for i,path in enumerate(valid_paths):
+			buffers[i] = path
+		return buffers, np.array(indices)
 	return np.array(valid_paths), np.array(indices)
 
-def get_features(paths, upper_bound=500, feature_names=[], resolution=0, include_offsets=False):
+FEATURE_DTYPES = ["int64", "uint64", "uint32", "float32"]
+VOCABULARY_FORMAT = "style_rank.vocabulary"
+VOCABULARY_VERSION = 1
+
+def save_vocabulary(path, domains, resolution=0, include_offsets=False):
+	"""save the domains returned by get_features, so that later calls to get_features can project new midis onto the same columns.
+
+	Args:
+		path (str): the .json file to write.
+		domains (dict): a dictionary of categorical domains (np.ndarray) indexed by feature name.
+		resolution (int): the resolution the domains were extracted with.
+		include_offsets (bool): the include_offsets flag the domains were extracted with.
+	"""
+	with open(path, "w") as f:
+		json.dump({
+			"format" : VOCABULARY_FORMAT,
+			"version" : VOCABULARY_VERSION,
+			"resolution" : int(resolution),
+			"include_offsets" : bool(include_offsets),
+			"domains" : {k : np.asarray(v, dtype=np.uint64).tolist() for k,v in domains.items()}}, f)
+
+def load_vocabulary(path):
+	"""load a vocabulary written by save_vocabulary.
+
+	Args:
+		path (str): the .json file to read.
+
+	Returns:
+		dict: the format, version, resolution, include_offsets and domains of the vocabulary.
+	"""
+	with open(path, "r") as f:
+		vocabulary = json.load(f)
+	if not isinstance(vocabulary, dict) or vocabulary.get("format") != VOCABULARY_FORMAT:
+		raise ValueError('{} is not a vocabulary'.format(path))
+	if vocabulary.get("version") != VOCABULARY_VERSION:
+		raise ValueError('{} has vocabulary version {}, expected {}'.format(path, vocabulary.get("version"), VOCABULARY_VERSION))
+	return vocabulary
+
+def validate_extraction(upper_bound, feature_names, resolution, include_offsets, dtype, sketch_size, vocabulary):
+	"""check the arguments shared by get_features and get_note_features, returning the feature names to extract and the domains of the vocabulary (if any)"""
+	validate_argument(upper_bound, "upper_bound")
+	validate_argument(resolution, "resolution")
+	if dtype not in FEATURE_DTYPES:
+		raise ValueError('dtype=%s is not one of %s' % (str(dtype), str(FEATURE_DTYPES)))
+	if sketch_size != 0 and sketch_size < upper_bound:
+		raise ValueError('sketch_size=%s must be 0 or at least upper_bound=%s' % (str(sketch_size), str(upper_bound)))
+	domains = {}
+	if vocabulary is not None:
+		if not isinstance(vocabulary, dict):
+			vocabulary = load_vocabulary(vocabulary)
+		if vocabulary["resolution"] != resolution or vocabulary["include_offsets"] != bool(include_offsets):
+			raise ValueError('the vocabulary was built with resolution={} and include_offsets={}'.format(vocabulary["resolution"], vocabulary["include_offsets"]))
+		if sketch_size != 0:
+			raise ValueError('sketch_size must be 0 when a vocabulary is provided')
+		domains = vocabulary["domains"]
+
+	feature_names = [f for f in feature_names if f in get_feature_names("ALL")]
+	missing = [f for f in feature_names if len(domains) and f not in domains]
+	if len(missing):
+		raise ValueError('{} are not in the vocabulary'.format(missing))
+	return feature_names, domains
+
+def feature_matrices(fs, sparse):
+	if sparse:
+		return {k : scipy.sparse.csr_matrix((data, columns, indptr), shape=shape, copy=False) for k,(data, columns, indptr, shape) in fs.items()}
+	return fs
+
+def get_features(paths, upper_bound=500, feature_names=[], resolution=0, include_offsets=False, num_threads=0, dtype="int64", sketch_size=0, vocabulary=None, sparse=False, return_stats=False, trace_path=None, return_names=False, reject_drums=False):
 	"""extract features for a list of midis
 
 	Args:
-		paths (list): a list of midi filepaths.
+		paths (list): a list of midi filepaths, and/or of midi files held in memory (bytes, bytearray or memoryview), which are read in place without being written to disk. A path may also be a zip or tar archive (.zip, .tar, .tar.gz or .tgz), each midi file (.mid or .midi) in which is read without extracting the archive to disk.
 		upper_bound (int): the maximum cardinality of each categorical distribution.
 		feature_names (list): a list of features to extract
 		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
 		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
+		num_threads (int): the number of threads used to extract features. If num_threads=0, all available cores are used.
+		dtype (str): the dtype of the distributions, one of "int64", "uint64", "uint32" or "float32". Counts that do not fit in an integer dtype saturate.
+		sketch_size (int): if sketch_size>0, the domain of each feature is chosen with a heavy hitter sketch of sketch_size counters, so that memory does not grow with the number of distinct values across paths. The domains may then differ slightly from the exact ones (see stream_report). A sketch_size of at least 10*upper_bound is recommended.
+		vocabulary (str or dict): a vocabulary written by save_vocabulary (or loaded with load_vocabulary). If provided, each feature is projected onto the domain in the vocabulary instead of a domain computed from paths, and upper_bound is ignored. If feature_names is empty, every feature in the vocabulary is extracted.
+		sparse (bool): a boolean flag indicating if the distributions are returned as scipy.sparse.csr_matrix instead of np.ndarray.
+		return_stats (bool): a boolean flag indicating if the time spent in each stage of the extraction is also returned.
+		trace_path (str): if provided, a timeline of the stages on each worker thread is written to trace_path in the chrome trace event format (open it in chrome://tracing or https://ui.perfetto.dev).
+		return_names (bool): a boolean flag indicating if the name of each midi is also returned.
+		reject_drums (bool): a boolean flag indicating if midis whose notes are all on the drum channel (10) are skipped. Files are scanned before they are parsed, and those that can not yield enough chords are always skipped without being parsed.
 
 	Returns:
-		fs (dict): a dictionary of categorical distributions (np.ndarray) indexed by feature name.
+		fs (dict): a dictionary of categorical distributions (np.ndarray or scipy.sparse.csr_matrix) indexed by feature name.
 		domains (dict): a dictionary of categorical domains (np.ndarray) indexed by feature name.
-		path_indices (np.ndarray): an integer array indexing the filepaths from which features were sucessfully extracted.
+		path_indices (np.ndarray): an integer array indexing the filepaths from which features were sucessfully extracted. Every midi in an archive has the index of the archive.
+		names (list): only if return_names=True. The name of each midi from which features were sucessfully extracted: its filepath, the archive path and its path in the archive joined by "/" for a midi in an archive, or None for a midi held in memory.
+		stats (dict): only if return_stats=True. The wall time in seconds, the number of worker threads, the number of pieces featurized and of notes and chords parsed, the number of midis skipped for each reason ("empty", "too_few_onsets", "drum_only" or "too_few_chords"), the number of chords and transitions looked up in the memo of per-chord feature values and how many were found in it ("chord_memo", with "lookups" and "hits"), and for each stage (e.g. "read", "chords", "chord_pass", "matrix") the number of calls, the wall time in seconds, the number of allocations and bytes allocated (zero unless the extension is built with -DSTYLE_RANK_COUNT_ALLOCATIONS), and the items it processed.
 	"""
-	validate_argument(upper_bound, "upper_bound")
-	validate_argument(resolution, "resolution")
+	feature_names, domains = validate_extraction(upper_bound, feature_names, resolution, include_offsets, dtype, sketch_size, vocabulary)
+	paths, path_indices = validate_paths(paths)
+	# the distributions and domains come back as numpy arrays that own the
+	# buffers they were computed in
+	(fs, domains, indices, members, stats) = get_features_internal(paths, feature_names, upper_bound, resolution, include_offsets, num_threads, dtype, sketch_size, domains, sparse, return_stats, trace_path or "", reject_drums)
+	fs = feature_matrices(fs, sparse)
+	ret = [fs, domains, path_indices[np.array(indices, dtype=np.int64)]]
+	if return_names:
+		ret.append([(str(paths[i]) + ("/" + m if len(m) else "")) if isinstance(paths[i], str) else None for i,m in zip(indices, members)])
+	if return_stats:
+		ret.append(stats)
+	return tuple(ret)
+
+def validate_note_arrays(notes, offsets, width, name):
+	"""concatenate a list of arrays, checking the shape of notes and that offsets delimits its rows"""
+	if isinstance(notes, (list, tuple)):
+		if offsets is not None:
+			raise ValueError('offsets must be None when %s is a list of arrays' % name)
+		notes = [np.asarray(x) for x in notes]
+		offsets = np.cumsum([0] + [len(x) for x in notes])
+		notes = np.concatenate(notes) if len(notes) else np.zeros((0,width), dtype=np.int64)
+	notes = np.asarray(notes)
+	if notes.ndim != 2 or notes.shape[1] != width:
+		raise ValueError('%s must have shape (n,%d)' % (name, width))
+	if not (np.issubdtype(notes.dtype, np.integer) or notes.dtype == np.bool_):
+		raise ValueError('%s must be an integer array' % name)
+	if offsets is None:
+		offsets = [0, len(notes)]
+	offsets = np.asarray(offsets)
+	if offsets.ndim != 1 or len(offsets) < 1 or offsets[0] != 0 or offsets[-1] != len(notes) or np.any(np.diff(offsets) < 0):
+		raise ValueError('offsets must be non-decreasing from 0 to len(%s)' % name)
+	return notes, [int(x) for x in offsets]
+
+def get_note_features(notes, offsets=None, ticks_per_beat=1, piano_roll=False, upper_bound=500, feature_names=[], resolution=0, include_offsets=False, num_threads=0, dtype="int64", sketch_size=0, vocabulary=None, sparse=False):
+	"""extract features for pieces given as notes or piano rolls rather than midis, e.g. the output of a generative model
+
+	The pieces are built directly from the arrays, which are read in place when they are c-contiguous and of dtype int64 (notes) or uint8/bool (piano rolls).
+
+	Args:
+		notes (np.ndarray or list): an (n,4) integer array of (pitch, onset, duration, velocity) rows, with onsets and durations in ticks. If piano_roll=True, an (n,128) array of frames instead, in which each run of non-zero frames of a pitch is a note with the velocity of its first frame (binary piano rolls are accepted). A list of arrays (one per piece) is concatenated.
+		offsets (np.ndarray): piece i is notes[offsets[i]:offsets[i+1]]. If offsets=None, notes is a single piece (or a list of pieces).
+		ticks_per_beat (int): the number of ticks (frames of a piano roll) per beat.
+		piano_roll (bool): a boolean flag indicating if notes is a piano roll.
+		upper_bound (int): the maximum cardinality of each categorical distribution.
+		feature_names (list): a list of features to extract
+		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
+		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
+		num_threads (int): the number of threads used to extract features. If num_threads=0, all available cores are used.
+		dtype (str): the dtype of the distributions, one of "int64", "uint64", "uint32" or "float32".
+		sketch_size (int): as for get_features.
+		vocabulary (str or dict): as for get_features.
+		sparse (bool): a boolean flag indicating if the distributions are returned as scipy.sparse.csr_matrix instead of np.ndarray.
+
+	Returns:
+		fs (dict): a dictionary of categorical distributions (np.ndarray or scipy.sparse.csr_matrix) indexed by feature name.
+		domains (dict): a dictionary of categorical domains (np.ndarray) indexed by feature name.
+		piece_indices (np.ndarray): an integer array indexing the pieces from which features were sucessfully extracted.
+	"""
+	feature_names, domains = validate_extraction(upper_bound, feature_names, resolution, include_offsets, dtype, sketch_size, vocabulary)
+	if ticks_per_beat < 1:
+		raise ValueError('ticks_per_beat=%s must be positive' % str(ticks_per_beat))
+	notes, offsets = validate_note_arrays(notes, offsets, 128 if piano_roll else 4, "notes")
+	if piano_roll and notes.dtype == np.bool_:
+		notes = notes.view(np.uint8)
+	(fs, domains, indices) = get_note_features_internal(notes, offsets, ticks_per_beat, piano_roll, feature_names, upper_bound, resolution, include_offsets, num_threads, dtype, sketch_size, domains, sparse)
+	return feature_matrices(fs, sparse), domains, np.array(indices, dtype=np.int64)
+
+def iter_features(paths, feature_names=[], resolution=0, include_offsets=False, num_threads=0, queue_size=64):
+	"""extract features for a list of midis, yielding each one as soon as it is done
 
+	The midis are featurized on background threads, in no particular order. At most queue_size featurized midis wait to be consumed, after which the threads pause, so memory does not grow with the number of paths. Closing the generator (or dropping it) stops the threads.
+
+	Args:
+		paths (list): a list of midi filepaths, and/or of midi files held in memory (bytes, bytearray or memoryview).
+		feature_names (list): a list of features to extract
+		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
+		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
+		num_threads (int): the number of threads used to extract features. If num_threads=0, all available cores are used.
+		queue_size (int): the maximum number of featurized midis waiting to be consumed.
+
+	Yields:
+		index (int): the index in paths of a midi from which features were sucessfully extracted.
+		fs (dict): a dictionary of categorical distributions ({value: count}) indexed by feature name.
+	"""
+	validate_argument(resolution, "resolution")
+	if queue_size < 1:
+		raise ValueError('queue_size=%s must be positive' % str(queue_size))
 	paths, path_indices = validate_paths(paths)
 	feature_names = [f for f in feature_names if f in get_feature_names("ALL")]
-	(fs, domains, indices) = get_features_internal(paths, feature_names, upper_bound, resolution, include_offsets)
-	fs = {k : np.array(v).reshape(-1,len(domains[k])+1) for k,v in fs.items()}
-	domains = {k : np.array(v) for k,v in domains.items()}
-	path_indices = path_indices[np.array(indices)]
-	return fs, domains, path_indices
+	it = iter_features_internal(paths, feature_names, resolution, include_offsets, num_threads, queue_size)
+	try:
+		for index, fs in it:
+			yield int(path_indices[index]), fs
+	finally:
+		it.close()
+
+def stream_report():
+	"""the error bounds of the domains chosen by the last call to get_features with sketch_size>0.
+
+	Returns:
+		dict: for each feature, the number of rows, the number of values counted by the sketch (updates), the number of counters that were evicted (if 0 the domain is exact), the domain size, the largest overestimate of the number of paths containing a domain value (max_error), and the number of domain values that are certainly in the exact domain (guaranteed).
+	"""
+	return stream_report_internal()
 
-def get_feature_csv(paths, output_dir, upper_bound=500, feature_names=[], resolution=0, include_offsets=False):
+def get_feature_csv(paths, output_dir, upper_bound=500, feature_names=[], resolution=0, include_offsets=False, num_threads=0):
 	"""extract features for a list of midis and output to csv's
 
 	Args:
-		paths (list): a list of midi filepaths.
+		paths (list): a list of midi filepaths and/or archives of midi files. A midi in an archive is named by the archive path and its path in the archive joined by "/".
 		output_dir (str): a directory to store the feature .csv's
 		upper_bound (int): the maximum cardinality of each categorical distribution.
 		feature_names (list): a list of features to extract.
 		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
 		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
+		num_threads (int): the number of threads used to extract features. If num_threads=0, all available cores are used.
 	"""
-	data, domains, indices = get_features(
-		paths, upper_bound=upper_bound, feature_names=feature_names, resolution=resolution, include_offsets=include_offsets)
+	data, domains, _, names = get_features(
+		paths, upper_bound=upper_bound, feature_names=feature_names, resolution=resolution, include_offsets=include_offsets, num_threads=num_threads, return_names=True)
 	call(["mkdir", "-p", output_dir])
 	for k,v in data.items():
 		with open(os.path.join(output_dir, k) + ".csv", "w") as f:
 			w = csv.writer(f)
 			w.writerow(["filepath"] + list(domains[k]) + ["remain"])
-			for path, vv in zip(np.array(paths)[indices], v):
+			for path, vv in zip(names, v):
 				w.writerow([path] + list(vv))
 
-def rf_embed(feature, labels, n_estimators=100, max_depth=3):
+def forest_input(feature):
+	"""convert a feature to the input of rf_leaves_internal: a float32 matrix, or the (data, indices, indptr, n_columns) of a csr matrix."""
+	if scipy.sparse.issparse(feature):
+		feature = scipy.sparse.csr_matrix(feature)
+		return (np.asarray(feature.data, dtype=np.float32), np.asarray(feature.indices, dtype=np.int32), np.asarray(feature.indptr, dtype=np.int32), feature.shape[1])
+	return np.asarray(feature, dtype=np.float32)
+
+def rf_leaves(features, labels, n_estimators=100, max_depth=3, num_threads=0, random_state=None):
+	"""train a random forest for each feature and find the leaf each sample falls into.
+
+	Args:
+		features (list): a list of matrices (np.ndarray or scipy.sparse) of shape (len(labels),D) with D>0.
+		labels (list): a list of integers on the range [0,1]
+		n_estimators (int): the number of trees in each random forest
+		max_depth (int): the maximum depth of each tree
+		num_threads (int): the number of threads used to train the forests. If num_threads=0, all available cores are used.
+		random_state (int): a seed for the forests. If random_state=None, a random seed is used.
+
+	Returns:
+		list: a list of integer matrices of shape (len(labels),n_estimators) containing the leaf index of each sample in each tree.
+	"""
+	if random_state is None:
+		random_state = np.random.randint(2**31)
+	features = [forest_input(f) for f in features]
+	labels = [int(l) for l in labels]
+	return rf_leaves_internal(features, labels, n_estimators, max_depth, random_state, num_threads)
+
+def leaf_similarity(leaves):
+	"""compute the cosine similarity between the one-hot encoded leaves of each sample.
+
+	Args:
+		leaves (np.ndarray): a matrix of shape (N,n_estimators) containing leaf indices.
+
+	Returns:
+		np.ndarray: a matrix containg all pairwise similarities.
+	"""
+	embedded = np.array(
+		OneHotEncoder(categories='auto').fit_transform(leaves).todense())
+	return 1. - cosine_distances(embedded)
+
+def rf_embed(feature, labels, n_estimators=100, max_depth=3, native=True, num_threads=0):
 	"""construct an embedding using a random forest.
 
 	Args:
@@ -161,37 +459,40 @@ def rf_embed(feature, labels, n_estimators=100, max_depth=3):
 		labels (list): a list of integers on the range [0,1]
 		n_estimators (int): the number of trees in the random forest
 		max_depth (int): the maximum depth of each tree
+		native (bool): use the native random forest instead of sklearn's RandomForestClassifier.
+		num_threads (int): the number of threads used to train the native forest. If num_threads=0, all available cores are used.
 
 	Returns:
 		np.ndarray: a matrix containg all pairwise similarities for a single categorical distribution (feature).
 
 	"""
-	clf = RandomForestClassifier(n_estimators=n_estimators, max_depth=max_depth, bootstrap=True, criterion='entropy', class_weight='balanced')
-	clf.fit(feature, labels)
-	leaves = clf.apply(feature)
-	embedded = np.array(
-		OneHotEncoder(categories='auto').fit_transform(leaves).todense())
-	return 1. - cosine_distances(embedded)
+	if native:
+		leaves = rf_leaves([feature], labels, n_estimators=n_estimators, max_depth=max_depth, num_threads=num_threads)[0]
+	else:
+		clf = RandomForestClassifier(n_estimators=n_estimators, max_depth=max_depth, bootstrap=True, criterion='entropy', class_weight='balanced')
+		clf.fit(feature, labels)
+		leaves = clf.apply(feature)
+	return leaf_similarity(leaves)
 
-def get_similarity_matrix(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=100, max_depth=3, return_paths_and_labels=False, resolution=0, include_offsets=False, feature_names=[]):
-	"""construct a similarity matrix
+def get_leaves(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=100, max_depth=3, resolution=0, include_offsets=False, feature_names=[], num_threads=0):
+	"""train a random forest for each feature and find the leaf each midi falls into
 
 	Args:
 		rank_set (list/np.ndarray): a list/array of midis to be ranked.
 		style_set (list/np.ndarray): a list/array of midis to define the style.
-		raw_features (dict): a dictionary of categorical distributions (np.ndarray) indexed by feature name.
+		raw_features (dict): a dictionary of categorical distributions (np.ndarray or scipy.sparse) indexed by feature name.
 		upper_bound (int): the maximum cardinality of each categorical distribution.
 		n_estimators (int): the number of trees in the random forest.
 		max_depth (int): the maximum depth of each tree.
-		return_paths_and_labels (int): a boolean flag indicating whether these items should be returned or not
 		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
 		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
 		feature_names (list): a list of features to extract. if feature_names=[] all features will be used.
+		num_threads (int): the number of threads used to extract features and train the random forests. If num_threads=0, all available cores are used.
 
 	Returns:
-		sim_mat (np.ndarray): a matrix containg all pairwise similarities.
-		paths (np.ndarray) : an array of midi filepaths corresponding to each row/col in the similarity matrix.
-		labels (np.ndarray): an array of labels corresponding to each row/col in the similarity matrix.
+		leaves (list): a list of matrices of shape (len(paths),n_estimators) containing leaf indices, one for each feature.
+		paths (np.ndarray) : an array of midi filepaths corresponding to each row in the leaf matrices. A midi in an archive is named by the archive path and its path in the archive joined by "/".
+		labels (np.ndarray): an array of labels corresponding to each row in the leaf matrices.
 	"""
 	validate_argument(n_estimators, "n_estimators")
 	validate_argument(max_depth, "max_depth")
@@ -204,33 +505,81 @@ def get_similarity_matrix(rank_set, style_set, raw_features=None, upper_bound=50
 
 	# extract features
 	if raw_features is None:
-		features, _, indices = get_features(paths, upper_bound=upper_bound, resolution=resolution, include_offsets=include_offsets, feature_names=feature_names)
+		features, _, indices, names = get_features(paths, upper_bound=upper_bound, resolution=resolution, include_offsets=include_offsets, feature_names=feature_names, num_threads=num_threads, dtype="float32", sparse=True, return_names=True)
 		labels = labels[indices]
+		# a midi in an archive is named by the archive path and its path in
+		# the archive, so that each row has a name of its own
+		names = [paths[i] if n is None else n for i,n in zip(indices, names)]
+		paths = np.array(names, dtype=object) if paths.dtype == object else np.array(names)
 	else:
 		validate_features(paths, labels, raw_features)
-		indices = np.arange(len(paths))
 		features = raw_features
 	
 	# ensure style_set and rank_set were parsed
 	validate_labels(labels)
 
 	# create embedding via trained random forests
+	leaves = rf_leaves(list(features.values()), labels, n_estimators=n_estimators, max_depth=max_depth, num_threads=num_threads)
+	return leaves, paths, labels
+
+def get_similarity_matrix(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=100, max_depth=3, return_paths_and_labels=False, resolution=0, include_offsets=False, feature_names=[], num_threads=0):
+	"""construct a similarity matrix
+
+	Args:
+		rank_set (list/np.ndarray): a list/array of midis to be ranked.
+		style_set (list/np.ndarray): a list/array of midis to define the style.
+		raw_features (dict): a dictionary of categorical distributions (np.ndarray or scipy.sparse) indexed by feature name.
+		upper_bound (int): the maximum cardinality of each categorical distribution.
+		n_estimators (int): the number of trees in the random forest.
+		max_depth (int): the maximum depth of each tree.
+		return_paths_and_labels (int): a boolean flag indicating whether these items should be returned or not
+		resolution (int): the number of divisions per beat for the quantization of time-based values. If resolution=0, no quantization will take place.
+		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
+		feature_names (list): a list of features to extract. if feature_names=[] all features will be used.
+		num_threads (int): the number of threads used to extract features and train the random forests. If num_threads=0, all available cores are used.
+
+	Returns:
+		sim_mat (np.ndarray): a matrix containg all pairwise similarities.
+		paths (np.ndarray) : an array of midi filepaths corresponding to each row/col in the similarity matrix.
+		labels (np.ndarray): an array of labels corresponding to each row/col in the similarity matrix.
+	"""
+	all_leaves, paths, labels = get_leaves(rank_set, style_set, upper_bound=upper_bound, n_estimators=n_estimators, max_depth=max_depth, raw_features=raw_features, resolution=resolution, include_offsets=include_offsets, feature_names=feature_names, num_threads=num_threads)
 	sim_mat = np.zeros((len(labels), len(labels)))
-	for _, feature in features.items():
-		sim_mat += rf_embed(feature, labels, n_estimators=n_estimators, max_depth=max_depth)
-	sim_mat /= len(features)
+	for leaves in all_leaves:
+		sim_mat += leaf_similarity(leaves)
+	sim_mat /= len(all_leaves)
 
 	if return_paths_and_labels:
-		return sim_mat, paths[indices], labels
+		return sim_mat, paths, labels
 	return sim_mat
 
-def rank(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=100, max_depth=3, return_similarity=False, resolution=0, include_offsets=False, feature_names=[], json_path=None):
+def leaf_style_scores(leaves, labels):
+	"""sum the similarity of each rank_set row to every style_set row without building the similarity matrix.
+
+	Each one-hot encoded row has exactly n_estimators ones, so the cosine similarity of two rows is the fraction of trees in which they share a leaf. Summed over the style_set, this is the number of style_set rows in each leaf, averaged over the trees.
+
+	Args:
+		leaves (np.ndarray): a matrix of shape (len(labels),n_estimators) containing leaf indices.
+		labels (list): a list of integers on the range [0,1]
+
+	Returns:
+		np.ndarray: an array containing the summed similarity to the style_set for each row with label 0.
+	"""
+	leaves = np.asarray(leaves, dtype=np.int64)
+	labels = np.asarray(labels)
+	n_leaves = leaves.max(0) + 1
+	offsets = np.concatenate([[0], np.cumsum(n_leaves)[:-1]])
+	flat = leaves + offsets[None,:]
+	counts = np.bincount(flat[labels==1].ravel(), minlength=n_leaves.sum())
+	return counts[flat[labels==0]].sum(1) / leaves.shape[1]
+
+def rank(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=100, max_depth=3, return_similarity=False, resolution=0, include_offsets=False, feature_names=[], json_path=None, num_threads=0):
 	"""construct a similarity matrix
 
 	Args:
 		rank_set (list/np.ndarray): a list/array of midis to be ranked.
 		style_set (list/np.ndarray): a list/array of midis to define the style.
-		features (dict): a dictionary of categorical distributions (np.ndarray) indexed by feature name.
+		features (dict): a dictionary of categorical distributions (np.ndarray or scipy.sparse) indexed by feature name.
 		upper_bound (int): the maximum cardinality of each categorical distribution.
 		n_estimators (int): the number of trees in the random forest.
 		max_depth (int): the maximum depth of each tree.
@@ -239,12 +588,16 @@ def rank(rank_set, style_set, raw_features=None, upper_bound=500, n_estimators=1
 		include_offsets (int): a boolean flag indicating if offsets will be considered for chord segment boundaries.
 		feature_names (list): a list of features to extract. if feature_names=[] all features will be used.
 		json_path (str): if not None, the ranks will be written to a .json file.
+		num_threads (int): the number of threads used to extract features and train the random forests. If num_threads=0, all available cores are used.
 
 	Returns:
-		paths (np.ndarray): an array containing the rank_set sorted from most to least stylistically similar to the corpus.
+		paths (np.ndarray): an array containing the rank_set sorted from most to least stylistically similar to the corpus. Each midi in an archive is ranked on its own, named by the archive path and its path in the archive joined by "/".
 	"""
-	sim_mat,paths,labels = get_similarity_matrix(rank_set, style_set, upper_bound=upper_bound, n_estimators=n_estimators, max_depth=max_depth, return_paths_and_labels=True, raw_features=raw_features, resolution=resolution, include_offsets=include_offsets, feature_names=feature_names)
-	sims = sim_mat[labels==0][:,labels==1].sum(1)
+	all_leaves,paths,labels = get_leaves(rank_set, style_set, upper_bound=upper_bound, n_estimators=n_estimators, max_depth=max_depth, raw_features=raw_features, resolution=resolution, include_offsets=include_offsets, feature_names=feature_names, num_threads=num_threads)
+	sims = np.zeros(((labels==0).sum(),))
+	for leaves in all_leaves:
+		sims += leaf_style_scores(leaves, labels)
+	sims /= len(all_leaves)
 	order = np.argsort(sims)[::-1]
 	output = list(zip(paths[order], sims[order]))
 	if json_path is not None:
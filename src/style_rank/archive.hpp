@@ -0,0 +1,361 @@
+#ifndef STYLE_RANK_ARCHIVE_H
+#define STYLE_RANK_ARCHIVE_H
+
+#include "smf.hpp"
+#include "profile.hpp"
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cctype>
+#include <cstring>
+#include <climits>
+#include <stdexcept>
+#include <algorithm>
+#include <stdint.h>
+#include <zlib.h>
+
+using namespace std;
+
+// reads the midi files in a zip or tar archive (optionally gzipped) without
+// extracting it to disk. a zip or plain tar is mapped, and its members are
+// read in place, so only the members of a zip that are deflated are copied,
+// by whichever worker inflates them. a gzipped tar is a single deflate
+// stream, so it is decompressed in order as members are read.
+
+// a midi file in an archive
+class ARCHIVE_MEMBER {
+public:
+  string name;
+  const uint8_t *data = nullptr; // in the mapped archive or in buffer
+  size_t size = 0; // of data
+  size_t inflated_size = 0; // of the file, if data is deflated
+  bool deflated = false;
+  bool readable = true; // false for members that are encrypted or compressed with another method
+  vector<uint8_t> buffer; // the member of a gzipped tar
+
+  // the midi file, inflated into out if need be. returns false if it can
+  // not be read.
+  bool read(vector<uint8_t> &out, const uint8_t *&midi, size_t &midi_size) const {
+    if (!readable || !data) return false;
+    if (!deflated) {
+      midi = data;
+      midi_size = size;
+      return true;
+    }
+    PROFILE_SCOPE scope(STAGE_INFLATE);
+    if ((size > UINT_MAX) || (inflated_size > UINT_MAX)) return false;
+    out.resize(inflated_size);
+    z_stream s;
+    memset(&s, 0, sizeof(s));
+    if (inflateInit2(&s, -MAX_WBITS) != Z_OK) return false;
+    s.next_in = (Bytef*)data;
+    s.avail_in = size;
+    s.next_out = out.data();
+    s.avail_out = inflated_size;
+    int status = inflate(&s, Z_FINISH);
+    inflateEnd(&s);
+    if ((status != Z_STREAM_END) || (s.total_out != inflated_size)) return false;
+    midi = out.data();
+    midi_size = out.size();
+    scope.count(midi_size);
+    return true;
+  }
+};
+
+class MIDI_ARCHIVE {
+public:
+  // whether a path names an archive, by its extension
+  static bool is_archive(const string &path) {
+    return ends_with(path, ".zip") || ends_with(path, ".tar") ||
+      ends_with(path, ".tar.gz") || ends_with(path, ".tgz");
+  }
+
+  // throws runtime_error if the archive can not be read
+  MIDI_ARCHIVE(const string &_path) : path(_path) {
+    if (ends_with(path, ".zip")) {
+      map();
+      readDirectory();
+    }
+    else if (ends_with(path, ".tar")) {
+      map();
+    }
+    else {
+      gz = gzopen(path.c_str(), "rb");
+      if (!gz) {
+        throw runtime_error("failed to open " + path);
+      }
+      gzbuffer(gz, 1 << 17);
+    }
+  }
+  ~MIDI_ARCHIVE() {
+    if (gz) gzclose(gz);
+  }
+  MIDI_ARCHIVE(const MIDI_ARCHIVE&) = delete;
+  MIDI_ARCHIVE& operator=(const MIDI_ARCHIVE&) = delete;
+
+  // replace batch with the next n midi files at most. returns false once
+  // there are none left. the members point into the archive, so they are
+  // only valid while it is.
+  bool read(vector<ARCHIVE_MEMBER> &batch, size_t n) {
+    PROFILE_SCOPE scope(STAGE_ARCHIVE);
+    batch.clear();
+    while ((batch.size() < n) && (zipped ? nextZip(batch) : nextTar(batch)));
+    scope.count(batch.size());
+    return !batch.empty();
+  }
+
+private:
+  string path;
+  unique_ptr<MAPPED_FILE> file;
+  gzFile gz = nullptr;
+  size_t pos = 0; // the next tar header in file
+  bool done = false;
+
+  struct ZIP_ENTRY {
+    string name;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t inflated_size;
+    int method;
+    bool encrypted;
+  };
+  bool zipped = false;
+  vector<ZIP_ENTRY> entries;
+  size_t next = 0;
+
+  static bool ends_with(const string &s, const string &suffix) {
+    if (s.size() < suffix.size()) return false;
+    for (size_t i=0; i<suffix.size(); i++) {
+      if (tolower(s[s.size() - suffix.size() + i]) != suffix[i]) return false;
+    }
+    return true;
+  }
+  static bool is_midi(const string &name) {
+    return ends_with(name, ".mid") || ends_with(name, ".midi");
+  }
+  static uint64_t le(const uint8_t *p, int n) {
+    uint64_t x = 0;
+    for (int i=n-1; i>=0; i--) x = (x << 8) | p[i];
+    return x;
+  }
+
+  void map() {
+    file.reset(new MAPPED_FILE(path));
+    if (!file->data) {
+      throw runtime_error("failed to read " + path);
+    }
+  }
+  void malformed() {
+    throw runtime_error(path + " is not a valid archive");
+  }
+
+  // the central directory, from the end of central directory record (or
+  // its zip64 counterpart when there are too many entries for it)
+  void readDirectory() {
+    zipped = true;
+    const uint8_t *d = file->data;
+    size_t size = file->size;
+    if (size < 22) malformed();
+    size_t eocd = size - 22;
+    size_t lowest = (size > 22 + 65535) ? size - 22 - 65535 : 0;
+    while (le(d + eocd, 4) != 0x06054b50) {
+      if (eocd == lowest) malformed();
+      eocd--;
+    }
+    uint64_t count = le(d + eocd + 10, 2);
+    uint64_t offset = le(d + eocd + 16, 4);
+    if (((count == 0xffff) || (offset == 0xffffffff)) && (eocd >= 20) && (le(d + eocd - 20, 4) == 0x07064b50)) {
+      uint64_t zip64 = le(d + eocd - 12, 8);
+      if ((zip64 >= size) || (size - zip64 < 56) || (le(d + zip64, 4) != 0x06064b50)) malformed();
+      count = le(d + zip64 + 32, 8);
+      offset = le(d + zip64 + 48, 8);
+    }
+    size_t p = offset;
+    for (uint64_t i=0; i<count; i++) {
+      if ((p >= size) || (size - p < 46) || (le(d + p, 4) != 0x02014b50)) malformed();
+      ZIP_ENTRY e;
+      e.encrypted = le(d + p + 8, 2) & 1;
+      e.method = le(d + p + 10, 2);
+      e.size = le(d + p + 20, 4);
+      e.inflated_size = le(d + p + 24, 4);
+      e.offset = le(d + p + 42, 4);
+      size_t name_size = le(d + p + 28, 2);
+      size_t extra_size = le(d + p + 30, 2);
+      size_t comment_size = le(d + p + 32, 2);
+      if (name_size + extra_size + comment_size > size - p - 46) malformed();
+      e.name.assign((const char*)d + p + 46, name_size);
+      // sizes and offsets that do not fit are in the zip64 extra field
+      const uint8_t *x = d + p + 46 + name_size;
+      const uint8_t *x_end = x + extra_size;
+      while (x + 4 <= x_end) {
+        size_t id = le(x, 2);
+        size_t n = le(x + 2, 2);
+        const uint8_t *f = x + 4;
+        if (f + n > x_end) break;
+        if (id == 0x0001) {
+          for (uint64_t *v : {&e.inflated_size, &e.size, &e.offset}) {
+            if ((*v == 0xffffffff) && (f + 8 <= x + 4 + n)) {
+              *v = le(f, 8);
+              f += 8;
+            }
+          }
+        }
+        x += 4 + n;
+      }
+      if (is_midi(e.name)) {
+        entries.push_back(e);
+      }
+      p += 46 + name_size + extra_size + comment_size;
+    }
+  }
+
+  bool nextZip(vector<ARCHIVE_MEMBER> &batch) {
+    if (next >= entries.size()) return false;
+    const ZIP_ENTRY &e = entries[next++];
+    const uint8_t *d = file->data;
+    size_t size = file->size;
+    batch.emplace_back();
+    ARCHIVE_MEMBER &m = batch.back();
+    m.name = e.name;
+    m.deflated = (e.method == 8);
+    m.inflated_size = e.inflated_size;
+    m.readable = !e.encrypted && ((e.method == 0) || (e.method == 8));
+    if ((e.offset < size) && (size - e.offset >= 30) && (le(d + e.offset, 4) == 0x04034b50)) {
+      uint64_t begin = e.offset + 30 + le(d + e.offset + 26, 2) + le(d + e.offset + 28, 2);
+      if ((begin <= size) && (e.size <= size - begin)) {
+        m.data = d + begin;
+        m.size = e.size;
+      }
+    }
+    return true;
+  }
+
+  // point out at n more bytes of a tar. from the mapping if there is one,
+  // and otherwise decompressed into buf. returns false at the end of the
+  // archive.
+  bool take(size_t n, vector<uint8_t> &buf, const uint8_t *&out) {
+    if (file) {
+      if (n > file->size - pos) return false;
+      out = file->data + pos;
+      pos += n;
+      return true;
+    }
+    buf.resize(n);
+    size_t got = 0;
+    while (got < n) {
+      unsigned chunk = (unsigned)min(n - got, (size_t)INT_MAX);
+      int r = gzread(gz, buf.data() + got, chunk);
+      if (r <= 0) break;
+      got += r;
+    }
+    out = buf.data();
+    return got == n;
+  }
+
+  // skip n bytes of a tar. returns false at the end of the archive.
+  bool skip(uint64_t n) {
+    if (file) {
+      if (n > file->size - pos) return false;
+      pos += n;
+      return true;
+    }
+    return (n == 0) || (gzseek(gz, n, SEEK_CUR) >= 0);
+  }
+
+  static uint64_t octal(const uint8_t *p, int n) {
+    if (p[0] & 0x80) { // base-256, for sizes of 8GB and above
+      uint64_t x = p[0] & 0x7f;
+      for (int i=1; i<n; i++) x = (x << 8) | p[i];
+      return x;
+    }
+    uint64_t x = 0;
+    for (int i=0; i<n && p[i]; i++) {
+      if ((p[i] >= '0') && (p[i] <= '7')) x = (x << 3) | (p[i] - '0');
+    }
+    return x;
+  }
+
+  static string field(const uint8_t *p, size_t n) {
+    return string((const char*)p, strnlen((const char*)p, n));
+  }
+
+  // the path in a pax extended header, if it has one
+  static string pax_path(const uint8_t *p, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+      size_t len = 0;
+      size_t j = i;
+      while ((j < n) && (p[j] >= '0') && (p[j] <= '9')) len = len * 10 + (p[j++] - '0');
+      if ((len == 0) || (i + len > n)) break;
+      string record((const char*)p + j, i + len - j);
+      if (record.compare(0, 6, " path=") == 0) {
+        return record.substr(6, record.size() - 7);
+      }
+      i += len;
+    }
+    return "";
+  }
+
+  // the next midi file of a tar, skipping any other members
+  bool nextTar(vector<ARCHIVE_MEMBER> &batch) {
+    vector<uint8_t> header_buf, data_buf;
+    string long_name;
+    while (!done) {
+      const uint8_t *h;
+      if (!take(512, header_buf, h) || all_of(h, h + 512, [](uint8_t c){ return c == 0; })) {
+        done = true;
+        break;
+      }
+      uint64_t sum = 8 * ' ';
+      for (int i=0; i<512; i++) {
+        if ((i < 148) || (i >= 156)) sum += h[i];
+      }
+      if (sum != octal(h + 148, 8)) malformed();
+      char type = h[156];
+      uint64_t size = octal(h + 124, 12);
+      string name = field(h, 100);
+      if (memcmp(h + 257, "ustar", 5) == 0) {
+        string prefix = field(h + 345, 155);
+        if (!prefix.empty()) name = prefix + "/" + name;
+      }
+      if (!long_name.empty()) {
+        name = long_name;
+        long_name.clear();
+      }
+      uint64_t padded = (size + 511) & ~(uint64_t)511;
+      bool regular = (type == '0') || (type == '\0') || (type == '7');
+      if ((type == 'L') || (type == 'x') || (regular && is_midi(name))) {
+        const uint8_t *d;
+        if (!take(padded, data_buf, d)) malformed();
+        if (type == 'L') {
+          long_name = field(d, size);
+        }
+        else if (type == 'x') {
+          long_name = pax_path(d, size);
+        }
+        else {
+          batch.emplace_back();
+          ARCHIVE_MEMBER &m = batch.back();
+          m.name = name;
+          m.size = size;
+          if (file) {
+            m.data = d;
+          }
+          else {
+            data_buf.resize(size);
+            m.buffer = move(data_buf);
+            m.data = m.buffer.data();
+          }
+          return true;
+        }
+      }
+      else if (!skip(padded)) {
+        malformed();
+      }
+    }
+    return false;
+  }
+};
+
+#endif
@@ -2,6 +2,13 @@
 #include "parse.hpp"
 #include "features.hpp"
 #include "feature_map.hpp"
+#include "extract.hpp"
+#include "forest.hpp"
+#include "cache.hpp"
+#include "stream.hpp"
+#include "vocab.hpp"
+#include "store.hpp"
+#include "profile.hpp"
 
 #include <tuple>
 #include <vector>
@@ -19,25 +26,499 @@ vector<string> get_feature_names_internal(string tag="ORIGINAL") {
   return vector<string>();
 }
 
-tuple<VECTOR_MAP,VECTOR_MAP,vector<int>> get_features_internal(vector<string> &paths, vector<string> &feature_names, int upper_bound, int resolution, bool include_offsets) {
+// the parsed piece cache shared by every call, if enabled. iterators hold
+// on to the cache they started with.
+static shared_ptr<PIECE_CACHE> piece_cache;
+
+void enable_cache_internal(string &cache_dir, long long max_bytes, bool store_chords) {
+  piece_cache.reset(new PIECE_CACHE(cache_dir, max_bytes, store_chords));
+}
+
+void disable_cache_internal() {
+  piece_cache.reset();
+}
+
+map<string,long long> cache_stats_internal() {
+  if (!piece_cache) {
+    return map<string,long long>();
+  }
+  const auto &stats = piece_cache->stats;
+  return {
+    {"hits", (long long)stats.hits},
+    {"misses", (long long)stats.misses},
+    {"writes", (long long)stats.writes},
+    {"evictions", (long long)stats.evictions},
+    {"bytes", (long long)stats.bytes}
+  };
+}
+
+// the feature store shared by every call, if enabled
+static shared_ptr<FEATURE_STORE> feature_store;
+
+void enable_feature_store_internal(string &store_dir) {
+  feature_store.reset(new FEATURE_STORE(store_dir));
+}
+
+void disable_feature_store_internal() {
+  feature_store.reset();
+}
+
+long long compact_feature_store_internal() {
+  if (!feature_store) {
+    throw runtime_error("the feature store is not enabled");
+  }
+  return feature_store->compact();
+}
+
+map<string,long long> feature_store_stats_internal() {
+  if (!feature_store) {
+    return map<string,long long>();
+  }
+  const auto &stats = feature_store->stats;
+  return {
+    {"hits", (long long)stats.hits},
+    {"misses", (long long)stats.misses},
+    {"appends", (long long)stats.appends},
+    {"records", (long long)stats.records},
+    {"bytes", (long long)stats.bytes}
+  };
+}
+
+// a numpy array that takes ownership of data, which is freed when the
+// array is garbage collected
+template <typename T>
+py::array_t<T> adopt_array(unique_ptr<vector<T>> data, vector<py::ssize_t> shape) {
+  T *ptr = data->data();
+  py::capsule owner(data.get(), [](void *v) { delete reinterpret_cast<vector<T>*>(v); });
+  data.release();
+  return py::array_t<T>(shape, ptr, owner);
+}
+
+// build each feature matrix without the gil, then hand the buffers to numpy
+// without copying them
+template <typename T, typename COLLECTOR>
+py::dict feature_arrays(COLLECTOR &c, const VECTOR_MAP &domains) {
+  map<string,unique_ptr<vector<T>>> mats;
+  {
+    py::gil_scoped_release release;
+    for (const auto &kv : domains) {
+      PROFILE_SCOPE scope(STAGE_MATRIX);
+      auto &mat = mats[kv.first];
+      mat.reset(new vector<T>(c.rows(kv.first) * (kv.second.size() + 1)));
+      c.getMatrix(kv.first, kv.second, mat->data());
+    }
+  }
+  py::dict ret;
+  for (auto &kv : mats) {
+    py::ssize_t rows = c.rows(kv.first);
+    py::ssize_t cols = domains.at(kv.first).size() + 1;
+    ret[py::str(kv.first)] = adopt_array(move(kv.second), {rows, cols});
+  }
+  return ret;
+}
+
+// the same, as (data, indices, indptr, shape) of a csr matrix
+template <typename T, typename COLLECTOR>
+py::dict feature_csr(COLLECTOR &c, const VECTOR_MAP &domains) {
+  map<string,CSR_MATRIX<T>> mats;
+  {
+    py::gil_scoped_release release;
+    for (const auto &kv : domains) {
+      PROFILE_SCOPE scope(STAGE_MATRIX);
+      c.getCSR(kv.first, kv.second, mats[kv.first]);
+    }
+  }
+  py::dict ret;
+  for (auto &kv : mats) {
+    py::ssize_t rows = kv.second.rows();
+    py::ssize_t cols = domains.at(kv.first).size() + 1;
+    py::ssize_t nnz = kv.second.data.size();
+    ret[py::str(kv.first)] = py::make_tuple(
+      adopt_array(unique_ptr<vector<T>>(new vector<T>(move(kv.second.data))), {nnz}),
+      adopt_array(unique_ptr<vector<int32_t>>(new vector<int32_t>(move(kv.second.indices))), {nnz}),
+      adopt_array(unique_ptr<vector<int32_t>>(new vector<int32_t>(move(kv.second.indptr))), {rows + 1}),
+      py::make_tuple(rows, cols));
+  }
+  return ret;
+}
+
+template <typename T, typename COLLECTOR>
+py::dict feature_output(COLLECTOR &c, const VECTOR_MAP &domains, bool sparse) {
+  return sparse ? feature_csr<T>(c, domains) : feature_arrays<T>(c, domains);
+}
+
+// extract(c, feature_names) fills c with the distributions of each piece
+// and returns the indices of the pieces that were featurized
+template <typename COLLECTOR, typename EXTRACT>
+py::tuple collect_features(COLLECTOR &c, EXTRACT extract, const vector<string> &feature_names, int upper_bound, string dtype, bool sparse) {
+  vector<int> indices;
+  VECTOR_MAP domains;
+  {
+    py::gil_scoped_release release;
+    indices = extract(c, feature_names);
+    for (const auto &name : c.names()) {
+      PROFILE_SCOPE scope(STAGE_DOMAINS);
+      domains[name] = c.getDomain(name, upper_bound);
+    }
+  }
+
+  py::dict fs;
+  if (dtype == "int64") fs = feature_output<int64_t>(c, domains, sparse);
+  else if (dtype == "uint64") fs = feature_output<uint64_t>(c, domains, sparse);
+  else if (dtype == "uint32") fs = feature_output<uint32_t>(c, domains, sparse);
+  else fs = feature_output<float>(c, domains, sparse);
+
+  py::dict doms;
+  for (auto &kv : domains) {
+    auto domain = unique_ptr<vector<uint64_t>>(new vector<uint64_t>(move(kv.second)));
+    py::ssize_t size = domain->size();
+    doms[py::str(kv.first)] = adopt_array(move(domain), {size});
+  }
+  return py::make_tuple(fs, doms, indices);
+}
+
+// the error bounds of each streamed domain, from the last call to
+// get_features_internal with a sketch
+static map<string,map<string,long long>> stream_report;
+
+// extract with the collector the arguments call for
+template <typename EXTRACT>
+py::tuple collect_with(EXTRACT extract, vector<string> &feature_names, int upper_bound, string dtype, int sketch_size, const VECTOR_MAP &vocabulary, bool sparse) {
+  if ((feature_names.size() == 0) && (vocabulary.size() > 0)) {
+    for (const auto &kv : vocabulary) {
+      feature_names.push_back(kv.first);
+    }
+  }
   if (feature_names.size() == 0) {
     feature_names = get_feature_names_internal();
   }
-  Collector c;
-  vector<int> indices;
-  for (int i=0; i<(int)paths.size(); i++) {
-    Piece *p = new Piece(paths[i], resolution, include_offsets);
-    if ((p) && (p->chords.size() > 10)) {
-      for (const auto &name : feature_names) {
-        c.add(name, m[name](p));
+  if ((dtype != "int64") && (dtype != "uint64") && (dtype != "uint32") && (dtype != "float32")) {
+    throw invalid_argument("dtype must be one of int64, uint64, uint32 or float32");
+  }
+  if (vocabulary.size() > 0) {
+    VOCAB_COLLECTOR c(vocabulary);
+    for (const auto &name : feature_names) {
+      if (!c.contains(name)) {
+        throw invalid_argument(name + " is not in the vocabulary");
+      }
+    }
+    return collect_features(c, extract, feature_names, upper_bound, dtype, sparse);
+  }
+  if (sketch_size <= 0) {
+    Collector c;
+    return collect_features(c, extract, feature_names, upper_bound, dtype, sparse);
+  }
+  STREAM_COLLECTOR c(sketch_size);
+  auto ret = collect_features(c, extract, feature_names, upper_bound, dtype, sparse);
+  stream_report.clear();
+  for (const auto &name : c.names()) {
+    DOMAIN_REPORT r = c.report(name, upper_bound);
+    stream_report[name] = {
+      {"rows", (long long)r.rows},
+      {"updates", (long long)r.updates},
+      {"evictions", (long long)r.evictions},
+      {"domain_size", (long long)r.domain_size},
+      {"max_error", (long long)r.max_error},
+      {"guaranteed", (long long)r.guaranteed}
+    };
+  }
+  return ret;
+}
+
+map<string,map<string,long long>> stream_report_internal() {
+  return stream_report;
+}
+
+// the stats of a profiled call, as returned by get_features
+py::dict profile_stats_dict(const PROFILE_STATS &stats) {
+  py::dict stages;
+  for (const auto &kv : stats.stages) {
+    py::dict stage;
+    stage["calls"] = kv.second.calls;
+    stage["seconds"] = kv.second.ns / 1e9;
+    stage["allocations"] = kv.second.allocations;
+    stage["allocated_bytes"] = kv.second.allocated_bytes;
+    stage["items"] = kv.second.items;
+    stages[py::str(kv.first)] = stage;
+  }
+  auto items = [&](const char *name) {
+    auto it = stats.stages.find(name);
+    return (it == stats.stages.end()) ? (uint64_t)0 : it->second.items;
+  };
+  py::dict ret;
+  ret["seconds"] = stats.ns / 1e9;
+  ret["threads"] = stats.threads;
+  ret["pieces"] = items(PROFILE_STAGE_NAMES[STAGE_FEATURES]);
+  ret["notes"] = items(PROFILE_STAGE_NAMES[STAGE_NOTES]);
+  ret["chords"] = items(PROFILE_STAGE_NAMES[STAGE_CHORDS]);
+  ret["dropped_events"] = stats.dropped_events;
+  py::dict rejected;
+  for (int i=0; i<N_REJECT_REASONS; i++) {
+    rejected[py::str(reject_reason_name((REJECT_REASON)i))] = stats.rejected[i];
+  }
+  ret["rejected"] = rejected;
+  py::dict memo;
+  memo["lookups"] = stats.memo_lookups;
+  memo["hits"] = stats.memo_hits;
+  ret["chord_memo"] = memo;
+  ret["stages"] = stages;
+  return ret;
+}
+
+// the midi files to featurize. a str is a path, and anything else must be
+// a buffer holding a whole midi file (bytes, bytearray, memoryview, ...),
+// which is read in place while it is held here.
+class MIDI_INPUTS {
+public:
+  vector<MIDI_SOURCE> sources;
+
+  MIDI_INPUTS(const vector<py::object> &inputs) {
+    for (const auto &x : inputs) {
+      if (py::isinstance<py::str>(x)) {
+        sources.push_back(MIDI_SOURCE(x.cast<string>()));
+        continue;
+      }
+      if (!py::isinstance<py::buffer>(x)) {
+        throw invalid_argument("each midi must be a path or a bytes-like object");
+      }
+      buffers.push_back(x.cast<py::buffer>().request());
+      const py::buffer_info &b = buffers.back();
+      py::ssize_t stride = b.itemsize;
+      for (py::ssize_t d=b.ndim-1; d>=0; d--) {
+        if ((b.shape[d] > 1) && (b.strides[d] != stride)) {
+          throw invalid_argument("each midi buffer must be contiguous");
+        }
+        stride *= b.shape[d];
+      }
+      sources.push_back(MIDI_SOURCE((const uint8_t*)b.ptr, b.size * b.itemsize));
+    }
+  }
+
+private:
+  vector<py::buffer_info> buffers;
+};
+
+py::tuple get_features_internal(vector<py::object> &paths, vector<string> &feature_names, int upper_bound, int resolution, bool include_offsets, int num_threads, string dtype="int64", int sketch_size=0, const VECTOR_MAP &vocabulary=VECTOR_MAP(), bool sparse=false, bool profile=false, string trace_path="", bool reject_drums=false) {
+  MIDI_INPUTS inputs(paths);
+  // held until the call returns, as the cache and store may be disabled by
+  // another thread while the GIL is released
+  shared_ptr<PIECE_CACHE> cache = piece_cache;
+  shared_ptr<FEATURE_STORE> store = feature_store;
+  vector<string> members;
+  auto extract = [&](auto &c, const vector<string> &names) {
+    members.clear();
+    return extract_features(
+      c, inputs.sources, names, resolution, include_offsets, num_threads, 
+      cache.get(), store.get(), &members, reject_drums);
+  };
+  if (!profile && trace_path.empty()) {
+    py::tuple ret = collect_with(extract, feature_names, upper_bound, dtype, sketch_size, vocabulary, sparse);
+    return py::make_tuple(ret[0], ret[1], ret[2], members, py::none());
+  }
+  unique_lock<mutex> session(profiler.session, defer_lock);
+  {
+    // wait for another profiled call without the GIL, which it needs to
+    // finish
+    py::gil_scoped_release release;
+    session.lock();
+  }
+  profiler.start(!trace_path.empty());
+  py::tuple ret;
+  try {
+    ret = collect_with(extract, feature_names, upper_bound, dtype, sketch_size, vocabulary, sparse);
+  }
+  catch (...) {
+    profiler.stop();
+    throw;
+  }
+  profiler.stop();
+  // read while the session is held, before another call can start
+  py::dict stats = profile_stats_dict(profiler.stats());
+  if (!trace_path.empty()) {
+    profiler.write_trace(trace_path);
+  }
+  return py::make_tuple(ret[0], ret[1], ret[2], members, stats);
+}
+
+using NOTE_MATRIX = py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+
+using ROLL_MATRIX = py::array_t<uint8_t, py::array::c_style | py::array::forcecast>;
+
+// pieces given as notes rather than midi files. notes is a (n,4) matrix of
+// (pitch, onset, duration, velocity) rows with ticks ticks per beat, or if
+// piano_roll is true a (n,128) matrix of velocities with ticks frames per
+// beat, and piece i is rows [offsets[i], offsets[i+1]). a c-contiguous
+// int64 (uint8 for a piano roll) array is read in place.
+py::tuple get_note_features_internal(py::object &notes, vector<size_t> &offsets, int ticks, bool piano_roll, vector<string> &feature_names, int upper_bound, int resolution, bool include_offsets, int num_threads, string dtype="int64", int sketch_size=0, const VECTOR_MAP &vocabulary=VECTOR_MAP(), bool sparse=false) {
+  if (piano_roll) {
+    ROLL_MATRIX mat = notes.cast<ROLL_MATRIX>();
+    if ((mat.ndim() != 2) || (mat.shape(1) != 128)) {
+      throw invalid_argument("a piano roll must be a matrix of size (n,128)");
+    }
+    PIANO_ROLL roll = {mat.data(), (size_t)mat.shape(0), ticks};
+    return collect_with([&](auto &c, const vector<string> &names) {
+      return extract_note_features(c, roll, offsets, names, resolution, include_offsets, num_threads);
+    }, feature_names, upper_bound, dtype, sketch_size, vocabulary, sparse);
+  }
+  NOTE_MATRIX mat = notes.cast<NOTE_MATRIX>();
+  if ((mat.ndim() != 2) || (mat.shape(1) != 4)) {
+    throw invalid_argument("notes must be a matrix of size (n,4)");
+  }
+  NOTE_ROWS rows = {mat.data(), (size_t)mat.shape(0), ticks};
+  return collect_with([&](auto &c, const vector<string> &names) {
+    return extract_note_features(c, rows, offsets, names, resolution, include_offsets, num_threads);
+  }, feature_names, upper_bound, dtype, sketch_size, vocabulary, sparse);
+}
+
+// a FEATURE_STREAM as a python iterator of (index, {feature: {value: count}})
+class FEATURE_ITERATOR {
+public:
+  FEATURE_ITERATOR(vector<py::object> &paths, vector<string> &_feature_names, int resolution, bool include_offsets, int num_threads, size_t queue_size) :
+    inputs(paths), feature_names(_feature_names), cache(piece_cache), store(feature_store) {
+    if (feature_names.size() == 0) {
+      feature_names = get_feature_names_internal();
+    }
+    stream.reset(new FEATURE_STREAM(inputs.sources, feature_names, resolution, include_offsets, 
+      num_threads, queue_size, cache.get(), store.get()));
+  }
+
+  py::tuple next() {
+    int index;
+    vector<unique_ptr<DISCRETE_DIST>> dists;
+    bool more;
+    {
+      py::gil_scoped_release release;
+      more = stream && stream->next(index, dists);
+    }
+    if (!more) {
+      throw py::stop_iteration();
+    }
+    py::dict fs;
+    for (size_t k=0; k<feature_names.size(); k++) {
+      py::dict hist;
+      for (const auto &kv : *dists[k]) {
+        hist[py::int_(kv.first)] = kv.second;
       }
-      indices.push_back(i);
+      fs[py::str(feature_names[k])] = hist;
     }
+    return py::make_tuple(index, fs);
+  }
+
+  // stop the workers, without waiting for the rest of the paths
+  void close() {
+    py::gil_scoped_release release;
+    stream.reset();
+  }
+
+private:
+  MIDI_INPUTS inputs;
+  vector<string> feature_names;
+  shared_ptr<PIECE_CACHE> cache;
+  shared_ptr<FEATURE_STORE> store;
+  unique_ptr<FEATURE_STREAM> stream;
+};
+
+FEATURE_ITERATOR *iter_features_internal(vector<py::object> &paths, vector<string> &feature_names, int resolution, bool include_offsets, int num_threads, int queue_size) {
+  if (queue_size <= 0) {
+    throw invalid_argument("queue_size must be positive");
+  }
+  return new FEATURE_ITERATOR(paths, feature_names, resolution, include_offsets, num_threads, queue_size);
+}
+
+using FLOAT_MATRIX = py::array_t<float, py::array::c_style | py::array::forcecast>;
+
+using INDEX_ARRAY = py::array_t<int32_t, py::array::c_style | py::array::forcecast>;
+
+// each feature is either a dense matrix or a csr matrix given as the tuple
+// (data, indices, indptr, n_columns)
+vector<py::array_t<int>> rf_leaves_internal(vector<py::object> &features, vector<int> &labels, int n_estimators, int max_depth, uint64_t seed, int num_threads) {
+  vector<FLOAT_MATRIX> dense(features.size());
+  vector<tuple<FLOAT_MATRIX,INDEX_ARRAY,INDEX_ARRAY,size_t>> csr(features.size());
+  vector<char> is_csr(features.size(), 0);
+  for (size_t k=0; k<features.size(); k++) {
+    if (py::isinstance<py::tuple>(features[k])) {
+      is_csr[k] = 1;
+      csr[k] = features[k].cast<tuple<FLOAT_MATRIX,INDEX_ARRAY,INDEX_ARRAY,size_t>>();
+      const auto &data = get<0>(csr[k]);
+      const auto &indices = get<1>(csr[k]);
+      const auto &indptr = get<2>(csr[k]);
+      size_t d = get<3>(csr[k]);
+      if ((indptr.ndim() != 1) || (indptr.shape(0) != (py::ssize_t)labels.size() + 1)) {
+        throw invalid_argument("each sparse feature must have len(labels) rows");
+      }
+      const int32_t *ptr = indptr.data();
+      if ((ptr[0] != 0) || (ptr[labels.size()] != indices.shape(0)) || (data.shape(0) != indices.shape(0))) {
+        throw invalid_argument("malformed csr matrix");
+      }
+      for (size_t i=0; i<labels.size(); i++) {
+        if (ptr[i] > ptr[i+1]) throw invalid_argument("malformed csr matrix");
+      }
+      for (py::ssize_t i=0; i<indices.shape(0); i++) {
+        if ((indices.data()[i] < 0) || ((size_t)indices.data()[i] >= d)) {
+          throw invalid_argument("csr column index out of range");
+        }
+      }
+    }
+    else {
+      dense[k] = features[k].cast<FLOAT_MATRIX>();
+      if ((dense[k].ndim() != 2) || (dense[k].shape(0) != (py::ssize_t)labels.size())) {
+        throw invalid_argument("each feature must be a matrix of size (len(labels),d)");
+      }
+    }
+  }
+  vector<vector<int>> leaves;
+  {
+    py::gil_scoped_release release;
+    vector<FOREST_DATA> data;
+    for (size_t k=0; k<features.size(); k++) {
+      if (is_csr[k]) {
+        data.emplace_back(get<0>(csr[k]).data(), get<1>(csr[k]).data(), get<2>(csr[k]).data(), 
+          labels.size(), get<3>(csr[k]), labels);
+      }
+      else {
+        data.emplace_back(dense[k].data(), dense[k].shape(0), dense[k].shape(1), labels);
+      }
+    }
+    leaves = forest_leaves(data, n_estimators, max_depth, seed, num_threads);
+  }
+  vector<py::array_t<int>> ret;
+  for (const auto &leaf : leaves) {
+    py::array_t<int> arr({(py::ssize_t)labels.size(), (py::ssize_t)n_estimators});
+    copy(leaf.begin(), leaf.end(), arr.mutable_data());
+    ret.push_back(arr);
   }
-  return tuple_cat(c.getData(upper_bound), tie(indices));
+  return ret;
 }
 
 PYBIND11_MODULE(_style_rank,m) {
-  m.def("get_features_internal", &get_features_internal);
+  m.def("get_features_internal", &get_features_internal,
+    py::arg("paths"), py::arg("feature_names"), py::arg("upper_bound"), 
+    py::arg("resolution"), py::arg("include_offsets"), py::arg("num_threads"), 
+    py::arg("dtype")="int64", py::arg("sketch_size")=0, 
+    py::arg("vocabulary")=VECTOR_MAP(), py::arg("sparse")=false,
+    py::arg("profile")=false, py::arg("trace_path")="", py::arg("reject_drums")=false);
+  m.def("get_note_features_internal", &get_note_features_internal,
+    py::arg("notes"), py::arg("offsets"), py::arg("ticks"), py::arg("piano_roll"),
+    py::arg("feature_names"), py::arg("upper_bound"), py::arg("resolution"), 
+    py::arg("include_offsets"), py::arg("num_threads"), 
+    py::arg("dtype")="int64", py::arg("sketch_size")=0, 
+    py::arg("vocabulary")=VECTOR_MAP(), py::arg("sparse")=false);
   m.def("get_feature_names_internal", &get_feature_names_internal);
+  m.def("rf_leaves_internal", &rf_leaves_internal);
+  m.def("enable_cache_internal", &enable_cache_internal);
+  m.def("disable_cache_internal", &disable_cache_internal);
+  m.def("cache_stats_internal", &cache_stats_internal);
+  m.def("stream_report_internal", &stream_report_internal);
+  m.def("enable_feature_store_internal", &enable_feature_store_internal);
+  m.def("disable_feature_store_internal", &disable_feature_store_internal);
+  m.def("compact_feature_store_internal", &compact_feature_store_internal,
+    py::call_guard<py::gil_scoped_release>());
+  m.def("feature_store_stats_internal", &feature_store_stats_internal);
+  py::class_<FEATURE_ITERATOR>(m, "FeatureIterator")
+    .def("__iter__", [](FEATURE_ITERATOR &it) -> FEATURE_ITERATOR& { return it; }, 
+      py::return_value_policy::reference_internal)
+    .def("__next__", &FEATURE_ITERATOR::next)
+    .def("close", &FEATURE_ITERATOR::close);
+  m.def("iter_features_internal", &iter_features_internal, 
+    py::return_value_policy::take_ownership);
 }
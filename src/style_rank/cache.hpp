@@ -0,0 +1,346 @@
+#ifndef STYLE_RANK_CACHE_H
+#define STYLE_RANK_CACHE_H
+
+#include "parse.hpp"
+#include "smf.hpp"
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <cstring>
+#include <cstdio>
+#include <stdexcept>
+#include <stdint.h>
+
+#include <dirent.h>
+#include <utime.h>
+
+using namespace std;
+
+// an on-disk cache of parsed pieces. each entry is one file holding the
+// note arrays (and optionally the chord segmentation) of a piece, keyed by
+// the content of the midi file and the parse parameters, in a flat binary
+// layout that is mapped and copied straight into a Piece. a warm run never
+// decodes midi or segments chords. entries are evicted least recently used
+// first (by modification time, which is refreshed on every hit) once the
+// cache grows past max_bytes.
+
+static const uint32_t PIECE_CACHE_VERSION = 1;
+static const char *PIECE_CACHE_SUFFIX = ".piece";
+
+uint64_t mix64(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// a 64 bit hash of a buffer, eight bytes at a time
+uint64_t content_hash(const uint8_t *data, size_t size) {
+  uint64_t h = mix64(size ^ 0x9e3779b97f4a7c15ULL);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, 8);
+    h = (h ^ mix64(word)) * 0x9e3779b97f4a7c15ULL;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, data + i, size - i);
+  return mix64(h ^ mix64(tail ^ (size - i)));
+}
+
+struct PIECE_CACHE_HEADER {
+  char magic[4];
+  uint32_t version;
+  uint64_t content_hash;
+  uint64_t content_size;
+  int32_t resolution;
+  int32_t include_offsets;
+  int32_t has_chords;
+  int32_t ticks;
+  int32_t track_count;
+  int32_t max_duration;
+  int32_t r;
+  uint32_t n_notes;
+  uint32_t n_onsets;
+  uint32_t n_onsets_and_offsets;
+  uint32_t n_chords;
+  uint32_t n_rests;
+  uint32_t n_chord_notes;
+  uint32_t n_chord_onsets;
+};
+
+// the serialized fields of a CHORD
+static const int CHORD_FIELDS = 6;
+
+class PIECE_CACHE_STATS {
+public:
+  atomic<uint64_t> hits{0};
+  atomic<uint64_t> misses{0};
+  atomic<uint64_t> writes{0};
+  atomic<uint64_t> evictions{0};
+  atomic<long long> bytes{0}; // on disk, as of the last scan or update
+};
+
+class PIECE_CACHE {
+public:
+  string dir;
+  long long max_bytes;
+  bool store_chords;
+  PIECE_CACHE_STATS stats;
+
+  PIECE_CACHE(const string &_dir, long long _max_bytes, bool _store_chords=true) {
+    dir = _dir;
+    max_bytes = _max_bytes;
+    store_chords = _store_chords;
+    if (dir.empty()) {
+      throw invalid_argument("cache directory must not be empty");
+    }
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+      throw runtime_error("cannot open cache directory " + dir);
+    }
+    closedir(d);
+    stats.bytes = scan(nullptr);
+  }
+
+  // the piece for path, from the cache if possible. the piece is parsed
+  // and stored on a miss.
+  unique_ptr<Piece> get(const string &path, int resolution, bool include_offsets) {
+    MAPPED_FILE file(path);
+    if (!file.data) {
+      return unique_ptr<Piece>(new Piece(path, resolution, include_offsets));
+    }
+    return get(file.data, file.size, resolution, include_offsets);
+  }
+
+  // the same, for a midi file held in memory
+  unique_ptr<Piece> get(const uint8_t *data, size_t size, int resolution, bool include_offsets) {
+    PROFILE_SCOPE scope(STAGE_CACHE);
+    uint64_t hash = content_hash(data, size);
+    string entry = entry_path(hash, size, resolution, include_offsets);
+
+    unique_ptr<Piece> p(new Piece());
+    if (load(entry, hash, size, resolution, include_offsets, p.get())) {
+      stats.hits++;
+      scope.count(1);
+      utime(entry.c_str(), nullptr);
+      return p;
+    }
+    stats.misses++;
+    p.reset(new Piece(data, size, resolution, include_offsets));
+    store(entry, hash, size, resolution, include_offsets, p.get());
+    return p;
+  }
+
+  string entry_path(uint64_t hash, uint64_t size, int resolution, bool include_offsets) const {
+    uint64_t key = mix64(hash ^ mix64(size) ^ mix64(((uint64_t)resolution << 1) | include_offsets));
+    char name[17];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long)key);
+    return dir + "/" + name + PIECE_CACHE_SUFFIX;
+  }
+
+private:
+  mutex evict_lock;
+  atomic<uint64_t> tmp_counter{0};
+
+  static size_t aligned(size_t n) {
+    return (n + 7) & ~(size_t)7;
+  }
+
+  template <typename T>
+  static void put(vector<char> &buf, const T *data, size_t n) {
+    size_t offset = buf.size();
+    buf.resize(aligned(offset + n * sizeof(T)), 0);
+    if (n) memcpy(buf.data() + offset, data, n * sizeof(T));
+  }
+
+  template <typename T>
+  static bool take(const char *&p, const char *e, vector<T> &out, size_t n) {
+    size_t bytes = aligned(n * sizeof(T));
+    if ((size_t)(e - p) < bytes) return false;
+    out.resize(n);
+    if (n) memcpy(out.data(), p, n * sizeof(T));
+    p += bytes;
+    return true;
+  }
+
+  static vector<int32_t> pack_chords(const vector<CHORD> &chords) {
+    vector<int32_t> packed;
+    packed.reserve(chords.size() * CHORD_FIELDS);
+    for (const auto &c : chords) {
+      int32_t fields[CHORD_FIELDS] = {c.begin, c.size, c.mask, c.onset_count, c.duration, c.onset};
+      packed.insert(packed.end(), fields, fields + CHORD_FIELDS);
+    }
+    return packed;
+  }
+
+  static void unpack_chords(const vector<int32_t> &packed, vector<CHORD> &chords) {
+    chords.resize(packed.size() / CHORD_FIELDS);
+    for (size_t i=0; i<chords.size(); i++) {
+      const int32_t *f = packed.data() + i * CHORD_FIELDS;
+      chords[i].begin = f[0];
+      chords[i].size = f[1];
+      chords[i].mask = f[2];
+      chords[i].onset_count = f[3];
+      chords[i].duration = f[4];
+      chords[i].onset = f[5];
+    }
+  }
+
+  // the chord spans must lie inside the buffers before they are bound
+  static bool valid_chords(const Piece *p, const vector<CHORD> &chords) {
+    for (const auto &c : chords) {
+      if ((c.begin < 0) || (c.size < 0) || (c.mask < 0)) return false;
+      if ((size_t)c.begin + c.size > p->chord_notes.size()) return false;
+      if ((size_t)c.mask + (c.size + 63) / 64 > p->chord_onsets.size()) return false;
+    }
+    return true;
+  }
+
+  bool load(const string &entry, uint64_t hash, uint64_t size, int resolution, bool include_offsets, Piece *p) const {
+    MAPPED_FILE file(entry);
+    if (!file.data || (file.size < aligned(sizeof(PIECE_CACHE_HEADER)))) return false;
+    PIECE_CACHE_HEADER h;
+    memcpy(&h, file.data, sizeof(h));
+    if ((memcmp(h.magic, "SRPC", 4) != 0) || (h.version != PIECE_CACHE_VERSION)) return false;
+    if ((h.content_hash != hash) || (h.content_size != size)) return false;
+    if ((h.resolution != resolution) || (h.include_offsets != (int)include_offsets)) return false;
+
+    const char *ptr = (const char*)file.data + aligned(sizeof(PIECE_CACHE_HEADER));
+    const char *end = (const char*)file.data + file.size;
+    vector<int32_t> chords, rests;
+    bool ok = take(ptr, end, p->notes.pitch, h.n_notes) &&
+      take(ptr, end, p->notes.onset, h.n_notes) &&
+      take(ptr, end, p->notes.duration, h.n_notes) &&
+      take(ptr, end, p->notes.velocity, h.n_notes) &&
+      take(ptr, end, p->notes.end, h.n_notes);
+    if (ok && h.has_chords) {
+      ok = take(ptr, end, p->onsets, h.n_onsets) &&
+        take(ptr, end, p->onsets_and_offsets, h.n_onsets_and_offsets) &&
+        take(ptr, end, chords, (size_t)h.n_chords * CHORD_FIELDS) &&
+        take(ptr, end, rests, (size_t)h.n_rests * CHORD_FIELDS) &&
+        take(ptr, end, p->chord_notes, h.n_chord_notes) &&
+        take(ptr, end, p->chord_pitches, h.n_chord_notes) &&
+        take(ptr, end, p->chord_onsets, h.n_chord_onsets);
+    }
+    if (!ok || (ptr != end)) return false;
+
+    p->ticks = h.ticks;
+    p->track_count = h.track_count;
+    p->max_duration = h.max_duration;
+    p->r = h.r;
+    if (h.has_chords) {
+      unpack_chords(chords, p->chords);
+      unpack_chords(rests, p->chords_w_rests);
+      if (!valid_chords(p, p->chords) || !valid_chords(p, p->chords_w_rests)) return false;
+      p->bindChords();
+    }
+    else {
+      p->findChords(include_offsets);
+    }
+    return true;
+  }
+
+  void store(const string &entry, uint64_t hash, uint64_t size, int resolution, bool include_offsets, const Piece *p) {
+    PIECE_CACHE_HEADER h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "SRPC", 4);
+    h.version = PIECE_CACHE_VERSION;
+    h.content_hash = hash;
+    h.content_size = size;
+    h.resolution = resolution;
+    h.include_offsets = include_offsets;
+    h.has_chords = store_chords;
+    h.ticks = p->ticks;
+    h.track_count = p->track_count;
+    h.max_duration = p->max_duration;
+    h.r = p->r;
+    h.n_notes = p->notes.size();
+    h.n_onsets = p->onsets.size();
+    h.n_onsets_and_offsets = p->onsets_and_offsets.size();
+    h.n_chords = p->chords.size();
+    h.n_rests = p->chords_w_rests.size();
+    h.n_chord_notes = p->chord_notes.size();
+    h.n_chord_onsets = p->chord_onsets.size();
+
+    vector<char> buf;
+    put(buf, &h, 1);
+    put(buf, p->notes.pitch.data(), h.n_notes);
+    put(buf, p->notes.onset.data(), h.n_notes);
+    put(buf, p->notes.duration.data(), h.n_notes);
+    put(buf, p->notes.velocity.data(), h.n_notes);
+    put(buf, p->notes.end.data(), h.n_notes);
+    if (store_chords) {
+      auto chords = pack_chords(p->chords);
+      auto rests = pack_chords(p->chords_w_rests);
+      put(buf, p->onsets.data(), h.n_onsets);
+      put(buf, p->onsets_and_offsets.data(), h.n_onsets_and_offsets);
+      put(buf, chords.data(), chords.size());
+      put(buf, rests.data(), rests.size());
+      put(buf, p->chord_notes.data(), h.n_chord_notes);
+      put(buf, p->chord_pitches.data(), h.n_chord_notes);
+      put(buf, p->chord_onsets.data(), h.n_chord_onsets);
+    }
+
+    // write to a private name and rename, so readers never see a partial entry
+    string tmp = entry + ".tmp." + to_string(getpid()) + "." + to_string(tmp_counter++);
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) return;
+    bool written = (fwrite(buf.data(), 1, buf.size(), f) == buf.size());
+    written &= (fclose(f) == 0);
+    if (!written || (rename(tmp.c_str(), entry.c_str()) != 0)) {
+      remove(tmp.c_str());
+      return;
+    }
+    stats.writes++;
+    if ((stats.bytes += buf.size()) > max_bytes) {
+      evict();
+    }
+  }
+
+  // the size of every entry, and optionally the entries with their
+  // modification times
+  long long scan(vector<pair<time_t,pair<string,long long>>> *entries) const {
+    long long total = 0;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return 0;
+    size_t suffix = strlen(PIECE_CACHE_SUFFIX);
+    while (struct dirent *ent = readdir(d)) {
+      string name = ent->d_name;
+      if ((name.size() <= suffix) || (name.compare(name.size() - suffix, suffix, PIECE_CACHE_SUFFIX) != 0)) continue;
+      string path = dir + "/" + name;
+      struct stat st;
+      if (stat(path.c_str(), &st) != 0) continue;
+      total += st.st_size;
+      if (entries) entries->push_back(make_pair(st.st_mtime, make_pair(path, (long long)st.st_size)));
+    }
+    closedir(d);
+    return total;
+  }
+
+  // remove the least recently used entries until the cache is at 90% of
+  // max_bytes, so eviction is not repeated on every write
+  void evict() {
+    lock_guard<mutex> guard(evict_lock);
+    vector<pair<time_t,pair<string,long long>>> entries;
+    long long total = scan(&entries);
+    long long target = max_bytes - max_bytes / 10;
+    if (total > max_bytes) {
+      sort(entries.begin(), entries.end());
+      for (const auto &e : entries) {
+        if (total <= target) break;
+        if (remove(e.second.first.c_str()) == 0) {
+          total -= e.second.second;
+          stats.evictions++;
+        }
+      }
+    }
+    stats.bytes = total;
+  }
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef STYLE_RANK_DISSONANCE_H
+#define STYLE_RANK_DISSONANCE_H
+
+#include <stdint.h>
+
+// the intervals used by the periodicity of a chord (Stolzenburg, "Harmony
+// perception by periodicity detection", 2015), built at compile time. an
+// interval of x semitones in [-128,128) is the frequency ratio of its pitch
+// class in just intonation, scaled by its octave (see calculate_dissonance.py).
+// every denominator is 2^a 3^b 5^c with b and c at most 1, so the lcm of
+// any of them is found from their largest exponents, without division.
+
+class DISSONANCE_INTERVAL {
+public:
+  uint32_t num;
+  uint32_t den;
+  double frac; // num / den
+  uint8_t twos; // the exponent of 2 in den
+  uint8_t odd; // 1 if 3 divides den, plus 2 if 5 divides den
+};
+
+// the denominator with the given exponents
+inline int dissonance_den(int twos, int odd) {
+  return (1 << twos) * ((odd & 1) ? 3 : 1) * ((odd & 2) ? 5 : 1);
+}
+
+class DISSONANCE_TABLE {
+public:
+  DISSONANCE_INTERVAL interval[256]; // indexed by x + 128
+
+  constexpr DISSONANCE_TABLE() : interval() {
+    const uint64_t tuning_num[12] = {1, 16, 9, 6, 5, 4, 7, 3, 8, 5, 9, 15};
+    const uint64_t tuning_den[12] = {1, 15, 8, 5, 4, 3, 5, 2, 5, 3, 5, 8};
+    for (int i=0; i<256; i++) {
+      int x = i - 128;
+      int pc = ((x % 12) + 12) % 12;
+      int octave = (x - pc) / 12;
+      uint64_t n = tuning_num[pc];
+      uint64_t d = tuning_den[pc];
+      if (octave < 0) {
+        d <<= -octave;
+      }
+      else {
+        n <<= octave;
+      }
+      uint64_t a = n, b = d;
+      while (b) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+      }
+      DISSONANCE_INTERVAL &e = interval[i];
+      e.num = n / a;
+      e.den = d / a;
+      e.frac = (double)e.num / e.den;
+      e.twos = 0;
+      e.odd = 0;
+      uint64_t rest = e.den;
+      while (rest % 2 == 0) {
+        rest /= 2;
+        e.twos++;
+      }
+      if (rest % 3 == 0) {
+        rest /= 3;
+        e.odd |= 1;
+      }
+      if (rest % 5 == 0) {
+        e.odd |= 2;
+      }
+    }
+  }
+};
+
+static constexpr DISSONANCE_TABLE dissonance_table;
+
+#endif
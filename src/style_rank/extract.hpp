@@ -0,0 +1,414 @@
+#ifndef STYLE_RANK_EXTRACT_H
+#define STYLE_RANK_EXTRACT_H
+
+#include "utils.hpp"
+#include "parse.hpp"
+#include "features.hpp"
+#include "feature_map.hpp"
+#include "fused.hpp"
+#include "thread_pool.hpp"
+#include "cache.hpp"
+#include "stream.hpp"
+#include "vocab.hpp"
+#include "store.hpp"
+#include "profile.hpp"
+#include "archive.hpp"
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <exception>
+#include <condition_variable>
+
+using namespace std;
+
+// a piece must have more than this many chords to be featurized
+static const int MIN_CHORDS = 10;
+
+// the number of pieces featurized before their distributions are handed to
+// the collector, which bounds the memory held by unclaimed distributions
+static const size_t EXTRACT_CHUNK = 1024;
+
+// a midi file to featurize: a path, or a whole file held in memory, which
+// must outlive the extraction. a path may also be an archive of midi files
+// (see MIDI_ARCHIVE::is_archive).
+class MIDI_SOURCE {
+public:
+  string path;
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  bool in_memory = false;
+  bool archive = false;
+
+  MIDI_SOURCE(const string &_path) : path(_path), archive(MIDI_ARCHIVE::is_archive(_path)) {}
+  MIDI_SOURCE(const uint8_t *_data, size_t _size) : data(_data), size(_size), in_memory(true) {}
+};
+
+// whether a midi file can be featurized, judged from a scan of its
+// note-ons before it is parsed. a piece has at most one chord per distinct
+// onset (plus one per note with include_offsets), so files that have too
+// few are rejected, along with empty files and, if reject_drums is set,
+// files with notes only on the drum channel (10). files the scan can not
+// decode are left to the parser, so this never rejects a piece that would
+// have been featurized, except for drums.
+bool prescan(const uint8_t *data, size_t size, bool include_offsets, bool reject_drums) {
+  PROFILE_SCOPE scope(STAGE_PRESCAN);
+  if (!data || (size == 0)) {
+    profiler.reject(REJECT_EMPTY);
+    return false;
+  }
+  static thread_local SMF_SCAN scan;
+  SMF_READER reader;
+  if (!reader.scan(data, size, scan)) return true;
+  if (scan.size() == 0) {
+    profiler.reject(REJECT_EMPTY);
+    return false;
+  }
+  if (reject_drums && (scan.note_ons[9] == scan.size())) {
+    profiler.reject(REJECT_DRUM_ONLY);
+    return false;
+  }
+  // count distinct onsets until there are enough
+  int limit = MIN_CHORDS - (include_offsets ? (int)scan.size() : 0);
+  int distinct[MIN_CHORDS + 1];
+  int n = 0;
+  for (int onset : scan.onsets) {
+    if (n > limit) return true;
+    if (find(distinct, distinct + n, onset) == distinct + n) {
+      distinct[n++] = onset;
+    }
+  }
+  if (n > limit) return true;
+  profiler.reject(REJECT_FEW_ONSETS);
+  return false;
+}
+
+bool prescan(const string &path, bool include_offsets, bool reject_drums) {
+  MAPPED_FILE file(path);
+  return prescan(file.data, file.size, include_offsets, reject_drums);
+}
+
+// the distributions of a piece. returns false if the piece has too few
+// chords, in which case dists is left empty.
+bool featurize_piece(Piece *p, const FusedExtractor &extractor, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+  if ((int)p->chords.size() <= MIN_CHORDS) {
+    profiler.reject(REJECT_FEW_CHORDS);
+    return false;
+  }
+  dists = extractor(p);
+  return true;
+}
+
+// the distributions of one path, from store if it has them. files that
+// fail the prescan are not parsed.
+bool featurize_path(const string &path, const FusedExtractor &extractor, const vector<string> &feature_names, int resolution, bool include_offsets, PIECE_CACHE *cache, FEATURE_STORE *store, vector<unique_ptr<DISCRETE_DIST>> &dists, bool reject_drums=false) {
+  bool valid = false;
+  // the store may hold drum-only files from runs that kept them
+  if (reject_drums && !prescan(path, include_offsets, true)) {
+    return false;
+  }
+  if (store && store->get(path, resolution, include_offsets, feature_names, valid, dists)) {
+    return valid;
+  }
+  if (reject_drums || prescan(path, include_offsets, false)) {
+    unique_ptr<Piece> p = cache ? 
+      cache->get(path, resolution, include_offsets) : 
+      unique_ptr<Piece>(new Piece(path, resolution, include_offsets));
+    valid = featurize_piece(p.get(), extractor, dists);
+  }
+  if (store) {
+    store->put(path, resolution, include_offsets, feature_names, valid, dists);
+  }
+  return valid;
+}
+
+// the distributions of one source. a file held in memory has no path to
+// key the store by, so only the cache applies to it.
+bool featurize_source(const MIDI_SOURCE &source, const FusedExtractor &extractor, const vector<string> &feature_names, int resolution, bool include_offsets, PIECE_CACHE *cache, FEATURE_STORE *store, vector<unique_ptr<DISCRETE_DIST>> &dists, bool reject_drums=false) {
+  if (!source.in_memory) {
+    return featurize_path(source.path, extractor, feature_names, resolution, include_offsets, cache, store, dists, reject_drums);
+  }
+  if (!prescan(source.data, source.size, include_offsets, reject_drums)) {
+    return false;
+  }
+  unique_ptr<Piece> p = cache ? 
+    cache->get(source.data, source.size, resolution, include_offsets) : 
+    unique_ptr<Piece>(new Piece(source.data, source.size, resolution, include_offsets));
+  return featurize_piece(p.get(), extractor, dists);
+}
+
+// call featurize(i, dists) for pieces [start, start+n) on num_threads
+// workers, and add the pieces that were featurized to the collector in
+// order, appending their indices to indices
+template <typename COLLECTOR, typename F>
+void extract_chunk(COLLECTOR &c, size_t start, size_t n, const vector<string> &feature_names, int num_threads, F featurize, vector<int> &indices) {
+  vector<vector<unique_ptr<DISCRETE_DIST>>> slots(n);
+  vector<char> valid(n, 0);
+  {
+    QUIET_SCOPE quiet; // silence midifile once for all workers
+    parallel_for(n, num_threads, [&](size_t i, int) {
+      valid[i] = featurize(start + i, slots[i]);
+    });
+  }
+
+  PROFILE_SCOPE collect(STAGE_COLLECT);
+  for (size_t i=0; i<n; i++) {
+    if (!valid[i]) continue;
+    for (int k=0; k<(int)feature_names.size(); k++) {
+      c.add(feature_names[k], move(slots[i][k]));
+    }
+    indices.push_back(start + i);
+    collect.count(1);
+  }
+}
+
+// call featurize(i, dists) for each of n pieces on num_threads workers,
+// where featurize returns false for pieces that are skipped. each piece
+// writes its distributions into its own slot, and the slots are added to
+// the collector in order after each chunk, so the rows are identical to a
+// serial run regardless of how the work was scheduled. returns the
+// indices of the pieces that were featurized. COLLECTOR is Collector,
+// STREAM_COLLECTOR or VOCAB_COLLECTOR. the stages are timed while the
+// profiler is running (see profile.hpp).
+template <typename COLLECTOR, typename F>
+vector<int> extract_pieces(COLLECTOR &c, size_t n_pieces, const vector<string> &feature_names, int num_threads, F featurize) {
+  PROFILE_SCOPE scope(STAGE_EXTRACT);
+  vector<int> indices;
+  for (size_t start=0; start<n_pieces; start+=EXTRACT_CHUNK) {
+    extract_chunk(c, start, min(EXTRACT_CHUNK, n_pieces - start), feature_names, num_threads, featurize, indices);
+  }
+  return indices;
+}
+
+// featurize the midi files in an archive, in the manner of extract_pieces,
+// reading EXTRACT_CHUNK of them at a time so memory does not grow with the
+// archive. members of a zip are inflated by the workers. the name of each
+// member that was featurized is appended to members.
+template <typename COLLECTOR>
+void extract_archive(COLLECTOR &c, const string &path, const FusedExtractor &extractor, const vector<string> &feature_names, int resolution, bool include_offsets, int num_threads, PIECE_CACHE *cache, vector<string> &members, bool reject_drums=false) {
+  PROFILE_SCOPE scope(STAGE_EXTRACT);
+  MIDI_ARCHIVE archive(path);
+  vector<ARCHIVE_MEMBER> batch;
+  vector<int> indices;
+  while (archive.read(batch, EXTRACT_CHUNK)) {
+    indices.clear();
+    extract_chunk(c, 0, batch.size(), feature_names, num_threads, 
+      [&](size_t i, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+        vector<uint8_t> inflated;
+        const uint8_t *data;
+        size_t size;
+        if (!batch[i].read(inflated, data, size)) return false;
+        return featurize_source(MIDI_SOURCE(data, size), extractor, feature_names, resolution, include_offsets, cache, nullptr, dists, reject_drums);
+      }, indices);
+    for (int i : indices) {
+      members.push_back(batch[i].name);
+    }
+  }
+}
+
+// parse and featurize each source, in the manner of extract_pieces.
+// parsed pieces are read from and added to cache when one is given, and
+// the distributions of paths are read from and appended to store when one
+// is given. every midi file in an archive is a piece, which gets the index
+// of the archive. if members is given, the name of the archive member each
+// piece came from is appended to it (an empty name for the other sources).
+// if reject_drums is set, files with notes only on the drum channel are
+// skipped (see prescan).
+template <typename COLLECTOR>
+vector<int> extract_features(COLLECTOR &c, const vector<MIDI_SOURCE> &sources, const vector<string> &feature_names, int resolution, bool include_offsets, int num_threads=0, PIECE_CACHE *cache=nullptr, FEATURE_STORE *store=nullptr, vector<string> *members=nullptr, bool reject_drums=false) {
+  FusedExtractor extractor(feature_names);
+  if (store) {
+    store->refresh();
+  }
+  vector<int> indices;
+  size_t i = 0;
+  while (i < sources.size()) {
+    if (sources[i].archive) {
+      vector<string> names;
+      extract_archive(c, sources[i].path, extractor, feature_names, resolution, include_offsets, num_threads, cache, names, reject_drums);
+      indices.insert(indices.end(), names.size(), i);
+      if (members) {
+        members->insert(members->end(), names.begin(), names.end());
+      }
+      i++;
+      continue;
+    }
+    size_t j = i;
+    while ((j < sources.size()) && !sources[j].archive) j++;
+    vector<int> run = extract_pieces(c, j - i, feature_names, num_threads, 
+      [&](size_t k, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+        return featurize_source(sources[i + k], extractor, feature_names, resolution, include_offsets, cache, store, dists, reject_drums);
+      });
+    for (int k : run) {
+      indices.push_back(i + k);
+    }
+    if (members) {
+      members->resize(members->size() + run.size());
+    }
+    i = j;
+  }
+  return indices;
+}
+
+template <typename COLLECTOR>
+vector<int> extract_features(COLLECTOR &c, const vector<string> &paths, const vector<string> &feature_names, int resolution, bool include_offsets, int num_threads=0, PIECE_CACHE *cache=nullptr, FEATURE_STORE *store=nullptr) {
+  vector<MIDI_SOURCE> sources(paths.begin(), paths.end());
+  return extract_features(c, sources, feature_names, resolution, include_offsets, num_threads, cache, store);
+}
+
+// featurize pieces given as notes (NOTE_ROWS) or as a piano roll
+// (PIANO_ROLL) rather than as midi files, in the manner of extract_pieces.
+// piece i is rows [offsets[i], offsets[i+1]), which are read in place.
+template <typename COLLECTOR, typename ROWS>
+vector<int> extract_note_features(COLLECTOR &c, const ROWS &rows, const vector<size_t> &offsets, const vector<string> &feature_names, int resolution, bool include_offsets, int num_threads=0) {
+  if (offsets.empty() || (offsets.front() != 0) || (offsets.back() != rows.size)) {
+    throw invalid_argument("offsets must run from 0 to the number of rows");
+  }
+  for (size_t i=0; i+1<offsets.size(); i++) {
+    if (offsets[i] > offsets[i+1]) {
+      throw invalid_argument("offsets must be non-decreasing");
+    }
+  }
+  FusedExtractor extractor(feature_names);
+  return extract_pieces(c, offsets.size() - 1, feature_names, num_threads, 
+    [&](size_t i, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+      Piece p(rows.slice(offsets[i], offsets[i+1]), resolution, include_offsets);
+      return featurize_piece(&p, extractor, dists);
+    });
+}
+
+// featurize sources on background workers and hand over each piece as soon
+// as it is done, in the order the pieces finish. at most queue_size
+// finished pieces wait for the consumer, beyond which the workers block,
+// so memory stays bounded however slowly the pieces are consumed. pieces
+// with too few chords are skipped. destroying the stream stops the
+// workers once their current piece is done.
+class FEATURE_STREAM {
+public:
+  FEATURE_STREAM(const vector<MIDI_SOURCE> &_sources, const vector<string> &_feature_names, int _resolution, bool _include_offsets, int num_threads=0, size_t _queue_size=64, PIECE_CACHE *_cache=nullptr, FEATURE_STORE *_store=nullptr) : 
+    sources(_sources), feature_names(_feature_names), extractor(_feature_names), resolution(_resolution), include_offsets(_include_offsets), queue_size(_queue_size), cache(_cache), store(_store) {
+    if (queue_size == 0) {
+      throw invalid_argument("queue_size must be positive");
+    }
+    for (const auto &source : sources) {
+      if (source.archive) {
+        throw invalid_argument("archives can not be streamed: " + source.path);
+      }
+    }
+    if (store) {
+      store->refresh();
+    }
+    if (sources.empty()) return;
+    int workers = resolve_num_threads(num_threads, sources.size());
+    for (int w=0; w<workers; w++) {
+      threads.emplace_back(&FEATURE_STREAM::work, this);
+    }
+  }
+  ~FEATURE_STREAM() {
+    close();
+  }
+  FEATURE_STREAM(const FEATURE_STREAM&) = delete;
+  FEATURE_STREAM& operator=(const FEATURE_STREAM&) = delete;
+
+  // wait for the next piece. returns false once every source is done. the
+  // first exception thrown by a worker is rethrown here.
+  bool next(int &index, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+    unique_lock<mutex> guard(lock);
+    while (true) {
+      ready.wait(guard, [this](){
+        return !queue.empty() || error || (finished == (int)threads.size());
+      });
+      if (error) {
+        exception_ptr e = error;
+        error = nullptr;
+        queue.clear();
+        guard.unlock();
+        close();
+        rethrow_exception(e);
+      }
+      if (queue.empty()) return false;
+      ITEM item = move(queue.front());
+      queue.pop_front();
+      space.notify_one();
+      if (item.valid) {
+        index = item.index;
+        dists = move(item.dists);
+        return true;
+      }
+    }
+  }
+
+  // stop the workers and wait for them
+  void close() {
+    {
+      lock_guard<mutex> guard(lock);
+      cancelled = true;
+    }
+    space.notify_all();
+    for (auto &t : threads) {
+      if (t.joinable()) t.join();
+    }
+  }
+
+private:
+  struct ITEM {
+    int index;
+    bool valid;
+    vector<unique_ptr<DISCRETE_DIST>> dists;
+  };
+
+  vector<MIDI_SOURCE> sources;
+  vector<string> feature_names;
+  FusedExtractor extractor;
+  int resolution;
+  bool include_offsets;
+  size_t queue_size;
+  PIECE_CACHE *cache;
+  FEATURE_STORE *store;
+
+  vector<thread> threads;
+  atomic<size_t> next_source{0};
+  mutex lock;
+  condition_variable ready; // signalled when a piece is queued or a worker ends
+  condition_variable space; // signalled when a piece is taken or on close
+  deque<ITEM> queue;
+  int finished = 0;
+  bool cancelled = false;
+  exception_ptr error = nullptr;
+
+  void work() {
+    QUIET_SCOPE quiet;
+    try {
+      while (true) {
+        size_t i = next_source++;
+        if (i >= sources.size()) break;
+        {
+          lock_guard<mutex> guard(lock);
+          if (cancelled) break;
+        }
+        ITEM item;
+        item.index = i;
+        item.valid = featurize_source(sources[i], extractor, feature_names, resolution, include_offsets, cache, store, item.dists);
+        unique_lock<mutex> guard(lock);
+        space.wait(guard, [this](){ return cancelled || (queue.size() < queue_size); });
+        if (cancelled) break;
+        queue.push_back(move(item));
+        ready.notify_one();
+      }
+    }
+    catch (...) {
+      lock_guard<mutex> guard(lock);
+      if (!error) error = current_exception();
+      cancelled = true;
+      space.notify_all();
+    }
+    lock_guard<mutex> guard(lock);
+    finished++;
+    ready.notify_all();
+  }
+};
+
+#endif
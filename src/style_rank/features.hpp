@@ -4,35 +4,93 @@
 #include "utils.hpp"
 #include "zip.hpp"
 #include "pcd.hpp"
+#include "dissonance.hpp"
 #include <cmath>
+#include <bitset>
 
 #include "libpopcnt.h"
 #include <assert.h>
 
 using namespace std;
 
-int lcm(int a, int b) {
-  int max = (a > b) ? a : b;
-  while(true) {
-    if (max % a == 0 && max % b == 0) {
-      break;
+int rough_quantize(int x, int ticks) {
+  return (int)round((double)x / ticks * 8);
+}
+
+// per-chord helpers shared by the feature functions and the fused kernel
+
+// the pitches as bits in an integer, where the lowest pitch is the LSB
+uint64_t pitch_shape(const CHORD &chord, CHORD_NOTES which=ALL_NOTES) {
+  uint64_t shape = 0;
+  int m = -1;
+  for (int i=0; i<chord.size; i++) {
+    if (!chord.selected(i, which)) continue;
+    if (m < 0) m = chord.pitch[i];
+    if ((chord.pitch[i] - m) < 64)
+      shape |= (1 << (chord.pitch[i] - m));
+  }
+  return shape;
+}
+
+// bits representing which notes are onsets, capped by a bit for the size
+uint64_t onset_shape(const CHORD &chord) {
+  uint64_t onset = 0;
+  for (int i=0; i<chord.size; i++) {
+    if (chord.is_onset(i))
+      onset |= (1 << i);
+  }
+  onset |= (1 << chord.size);
+  return onset;
+}
+
+int distinct_durations(const Piece *p, const CHORD &chord) {
+  int count = 0;
+  for (int i=0; i<chord.size; i++) {
+    bool seen = false;
+    for (int j=0; j<i && !seen; j++) {
+      seen = (p->notes.end[chord.note[j]] == p->notes.end[chord.note[i]]);
     }
-    else
-      ++max;
+    count += (int)!seen;
   }
-  return max;
+  return count;
 }
 
-int rough_quantize(int x, int ticks) {
-  return (int)round((double)x / ticks * 8);
+// onset and tied pitch classes rotated by the rotation of the whole chord
+uint64_t onset_tie_pcd_together(const CHORD_SUMMARY &s) {
+  int r = pc_sets[s.pc].rot;
+  return rotate_pcs(s.onset_pc, r) + (rotate_pcs(s.tie_pc, r) << 12);
+}
+
+// the mean periodicity of the intervals from each note in a to the notes
+// in b. the lcm of the denominators is that of their largest exponents.
+int periodicity(const CHORD &a, CHORD_NOTES wa, const CHORD &b, CHORD_NOTES wb) {
+  double periodicity = 0;
+  for (int i=0; i<a.size; i++) {
+    if (!a.selected(i, wa)) continue;
+    const DISSONANCE_INTERVAL *from = dissonance_table.interval + 128 - a.pitch[i];
+    int twos = 0;
+    int odd = 0;
+    double min_frac = 1;
+    for (int j=0; j<b.size; j++) {
+      if (!b.selected(j, wb)) continue;
+      const DISSONANCE_INTERVAL &x = from[b.pitch[j]];
+      if (x.frac < min_frac) {
+        min_frac = x.frac;
+      }
+      twos = max(twos, (int)x.twos);
+      odd |= x.odd;
+    }
+    periodicity += min_frac * dissonance_den(twos, odd);
+  }
+  return (int)(periodicity / a.count(wa));
 }
 
 unique_ptr<DISCRETE_DIST> IntervalDist(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist<12>();
   for (const auto &chord : p->chords) {
-    for (int j=0; j<(int)chord.notes.size(); j++) {
-      for (int k=j+1; k<(int)chord.notes.size(); k++) {
-        (*d)[mod(chord.notes[k]->pitch - chord.notes[j]->pitch, 12)] += chord.duration;
+    for (int j=0; j<chord.size; j++) {
+      for (int k=j+1; k<chord.size; k++) {
+        (*d)[mod(chord.pitch[k] - chord.pitch[j], 12)] += chord.duration;
       }
     }
   }
@@ -40,11 +98,11 @@ unique_ptr<DISCRETE_DIST> IntervalDist(Piece *p) /*ORIGINAL*/ {
 }
 
 unique_ptr<DISCRETE_DIST> IntervalClassDist(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist<7>();
   for (const auto &chord : p->chords) {
-    for (int j=0; j<(int)chord.notes.size(); j++) {
-      for (int k=j+1; k<(int)chord.notes.size(); k++) {
-        (*d)[interval_class[mod(chord.notes[k]->pitch - chord.notes[j]->pitch, 12)]] += chord.duration;
+    for (int j=0; j<chord.size; j++) {
+      for (int k=j+1; k<chord.size; k++) {
+        (*d)[interval_class[mod(chord.pitch[k] - chord.pitch[j], 12)]] += chord.duration;
       }
     }
   }
@@ -55,9 +113,9 @@ unique_ptr<DISCRETE_DIST> ChordSize(Piece *p) /*ORIGINAL*/ {
   /*
   The number of pitches in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[chord.notes.size()]++;
+  auto d = dense_dist<MAX_CHORD_SIZE+1>();
+  for (const auto &s : p->summaries) {
+    (*d)[s.size]++;
   }
   return d;
 }
@@ -66,17 +124,9 @@ unique_ptr<DISCRETE_DIST> ChordPCSizeRatio(Piece *p) /*ORIGINAL*/ {
   /*
   The ratio of distinct pitch classes to number of pitches in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    int pc[12] = {0};
-    int pccount = 0;
-    for (const auto &note : chord.notes) {
-      if (pc[mod(note->pitch,12)] == 0) {
-        pc[mod(note->pitch,12)] = 1;
-        pccount += 1;
-      }
-    }
-    (*d)[NOMINAL_TUPLE(pccount, chord.notes.size()).value]++;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[NOMINAL_TUPLE(pc_sets[s.pc].size, s.size).value]++;
   }
   return d;
 }
@@ -85,14 +135,9 @@ unique_ptr<DISCRETE_DIST> ChordOnsetRatio(Piece *p) /*ORIGINAL*/ {
   /*
   The ratio of onsets to number of pitches in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    int onset = 0;
-    for (int i=0; i<(int)chord.notes.size(); i++) {
-      if (chord.notes[i]->onset == chord.onset)
-        onset++;
-    }
-    (*d)[NOMINAL_TUPLE(onset, chord.notes.size()).value]++;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[NOMINAL_TUPLE(s.onset_count, s.size).value]++;
   }
   return d;
 }
@@ -101,13 +146,9 @@ unique_ptr<DISCRETE_DIST> ChordDistinctDurationRatio(Piece *p) /*ORIGINAL*/ {
   /*
   The ratio of distinct durations to the number of pitches in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (const auto &chord : p->chords) {
-    map<int,int> durations;
-    for (const auto &note : chord.notes) {
-      durations[note->onset + note->duration - chord.onset] = 1;
-    }
-    (*d)[NOMINAL_TUPLE(durations.size(), chord.notes.size()).value]++;
+    (*d)[NOMINAL_TUPLE(distinct_durations(p, chord), chord.size).value]++;
   }
   return d;
 }
@@ -116,9 +157,9 @@ unique_ptr<DISCRETE_DIST> ChordDuration(Piece *p) /*ORIGINAL*/ {
   /*
   The duration of a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[rough_quantize(chord.duration, p->ticks)]++;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[rough_quantize(s.duration, p->ticks)]++;
   }
   return d;
 }
@@ -127,15 +168,9 @@ unique_ptr<DISCRETE_DIST> ChordShape(Piece *p) /*ORIGINAL*/ {
   /*
   The pitches in a chord represented as bits in an integer, where the lowest pitch corresponding to the LSB.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (const auto &chord : p->chords) {
-    int m = chord.notes[0]->pitch;
-    uint64_t shape = 0;
-    for (const auto &note : chord.notes) {
-      if ((note->pitch - m) < 64)
-        shape |= (1 << (note->pitch - m));
-    }
-    (*d)[shape] += chord.duration;
+    (*d)[pitch_shape(chord)] += chord.duration;
   }
   return d;
 }
@@ -144,18 +179,9 @@ unique_ptr<DISCRETE_DIST> ChordOnsetShape(Piece *p) /*ORIGINAL*/ {
   /*
   The onset pitches in a chord represeted as bits in an integer, where the lowest pitch corresponding to the LSB
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (const auto &chord : p->chords) {
-    uint64_t shape = 0;
-    if (!chord.onset_notes.empty()) {
-      int m = chord.onset_notes[0]->pitch;
-      for (const auto &note : chord.onset_notes) {
-        if ((note->pitch - m) < 64) {
-          shape |= (1 << (note->pitch - m));
-        }
-      }
-    }
-    (*d)[shape] += chord.duration;
+    (*d)[pitch_shape(chord, ONSET_NOTES)] += chord.duration;
   }
   return d;
 }
@@ -164,9 +190,9 @@ unique_ptr<DISCRETE_DIST> ChordPCD(Piece *p) /*ORIGINAL*/ {
   /*
   The distinct pitch class set of notes represented as bits in an integer.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[pcd[PCINT(chord.notes).value]] += chord.duration;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[pc_sets[s.pc].pcd] += s.duration;
   }
   return d;
 }
@@ -175,9 +201,9 @@ unique_ptr<DISCRETE_DIST> ChordPCDWBass(Piece *p) /*ORIGINAL*/ {
   /*
   The distinct pitch class set of notes represented as bits in an integer. W bass
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[mod(chord.notes.front()->pitch,12) + (pcd[PCINT(chord.notes).value] << 12)] += chord.duration;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[mod(s.bass,12) + (pc_sets[s.pc].pcd << 12)] += s.duration;
   }
   return d;
 }
@@ -186,35 +212,25 @@ unique_ptr<DISCRETE_DIST> ChordOnsetPCD(Piece *p) /*ORIGINAL*/ {
   /*
   The distinct pitch class set of onset notes represented as bits in an integer.
   */
- auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
- for (const auto &chord : p->chords) {
-   (*d)[pcd[PCINT(chord.onset_notes).value]] += chord.duration;
+ auto d = sparse_dist();
+ for (const auto &s : p->summaries) {
+   (*d)[pc_sets[s.onset_pc].pcd] += s.duration;
  }
  return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordOnsetTiePCD(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[pcd[PCINT(chord.onset_notes).value] + (pcd[PCINT(chord.tie_notes).value] << 12)] += chord.duration;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[pc_sets[s.onset_pc].pcd + (pc_sets[s.tie_pc].pcd << 12)] += s.duration;
   }
   return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordOnsetTiePCDTogether(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    // get the number of rotations
-    int r = rot[PCINT(chord.notes).value];
-    int onsets = 0;
-    int ties = 0;
-    for (const auto &note : chord.onset_notes) {
-      onsets |= (1 << mod(note->pitch + r, 12));
-    }
-    for (const auto &note : chord.tie_notes) {
-      ties |= (1 << mod(note->pitch + r, 12));
-    }
-    (*d)[onsets + (ties << 12)] += chord.duration;
+  auto d = sparse_dist();
+  for (const auto &s : p->summaries) {
+    (*d)[onset_tie_pcd_together(s)] += s.duration;
   }
   return d;
 }
@@ -223,9 +239,9 @@ unique_ptr<DISCRETE_DIST> ChordTonnetz(Piece *p) /*ORIGINAL*/ {
   /*
   The distinct pitch class represented as bits in an integer.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[tonnetz[PCINT(chord.notes).value]] += chord.duration;
+  auto d = dense_dist<12>();
+  for (const auto &s : p->summaries) {
+    (*d)[pc_sets[s.pc].tonnetz] += s.duration;
   }
   return d;
 }
@@ -234,15 +250,9 @@ unique_ptr<DISCRETE_DIST> ChordOnset(Piece *p) /*ORIGINAL*/ {
   /*
   Bits representing which notes in a chord are onsets in ascending order. The lowest pitch is the LSB.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (const auto &chord : p->chords) {
-    uint64_t onset = 0;
-    for (int i=0; i<(int)chord.notes.size(); i++) {
-      if (chord.notes[i]->onset == chord.onset)
-        onset |= (1 << i);
-    }
-    onset |= (1 << chord.notes.size());
-    (*d)[onset]++;
+    (*d)[onset_shape(chord)]++;
   }
   return d;
 }
@@ -251,60 +261,28 @@ unique_ptr<DISCRETE_DIST> ChordRange(Piece *p) /*ORIGINAL*/ {
   /*
   The pitch range of notes in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    auto out = minmax_element(
-    chord.notes.begin(), chord.notes.end(), [](NOTE *a, NOTE *b){return a->pitch < b->pitch;});
-    (*d)[(*get<1>(out))->pitch - (*get<0>(out))->pitch]++;
+  auto d = dense_dist<128>();
+  for (const auto &s : p->summaries) {
+    (*d)[s.range()]++;
   }
   return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordDissonance(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (const auto &chord : p->chords) {
-    if (chord.onset_notes.size() >= 2) {
-      double periodicity = 0;
-      for (const auto &i : chord.onset_notes) {
-        int den_lcm = 1;
-        double min_frac = 1;
-        for (const auto &j : chord.onset_notes) {
-          int ii = j->pitch - i->pitch + 128;
-          double frac = (double)dissfracnum[ii] / dissfracden[ii];
-          if (frac < min_frac) {
-            min_frac = frac;
-          }
-          den_lcm = lcm(den_lcm, dissfracden[ii]);
-        }
-        periodicity += min_frac * den_lcm;
-      }
-      int p = (int)(periodicity / chord.onset_notes.size());
-      (*d)[p] += chord.duration;
+    if (chord.onset_count >= 2) {
+      (*d)[periodicity(chord, ONSET_NOTES, chord, ONSET_NOTES)] += chord.duration;
     }
   }
   return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordTranDissonance(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (int k=0; k<(int)p->chords.size()-1; k++) {
-    if ((p->chords[k].notes.size() >= 2) && (p->chords[k+1].notes.size() >= 2)) {
-      double periodicity = 0;
-      for (const auto &i : p->chords[k].notes) {
-        int den_lcm = 1;
-        double min_frac = 1;
-        for (const auto &j : p->chords[k+1].notes) {
-          int ii = j->pitch - i->pitch + 128;
-          double frac = (double)dissfracnum[ii] / dissfracden[ii];
-          if (frac < min_frac) {
-            min_frac = frac;
-          }
-          den_lcm = lcm(den_lcm, dissfracden[ii]);
-        }
-        periodicity += min_frac * den_lcm;
-      }
-      int per = (int)(periodicity / p->chords[k].notes.size());
-      (*d)[per]++; //= p->chords[k].duration;
+    if ((p->summaries[k].size >= 2) && (p->summaries[k+1].size >= 2)) {
+      (*d)[periodicity(p->chords[k], ALL_NOTES, p->chords[k+1], ALL_NOTES)]++; //= p->chords[k].duration;
     }
   }
   return d;
@@ -314,19 +292,20 @@ unique_ptr<DISCRETE_DIST> ChordLowestInterval(Piece *p) /*ORIGINAL*/ {
   /*
   The interval between the lowest two pitches in a chord.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    if (chord.notes.size() > 1) {
-      (*d)[chord.notes[1]->pitch - chord.notes[0]->pitch]++;
+  auto d = dense_dist<128>();
+  for (const auto &s : p->summaries) {
+    if (s.size > 1) {
+      (*d)[s.second - s.bass]++;
     }
   }
   return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordSizeNgram(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size() - 2; i++) {
-    (*d)[NOMINAL_TUPLE(p->chords[i].notes.size(), p->chords[i+1].notes.size(), p->chords[i+2].notes.size()).value]++; 
+  auto d = sparse_dist();
+  const auto &s = p->summaries;
+  for (int i=0; i<(int)s.size() - 2; i++) {
+    (*d)[NOMINAL_TUPLE(s[i].size, s[i+1].size, s[i+2].size).value]++;
   }
   return d;
 }
@@ -338,52 +317,58 @@ enum class VOICE_MOTION_TYPE : uint64_t {
   CONTRARY_MOTION,
 };
 
+VOICE_MOTION_TYPE voice_motion(const CHORD_SUMMARY &a, const CHORD_SUMMARY &b) {
+  int md = sgn(b.top - a.top);
+  int bd = sgn(b.bass - a.bass);
+  if (abs(md) + abs(bd) == 0) {
+    return VOICE_MOTION_TYPE::NO_CHANGE;
+  }
+  else if (abs(md) + abs(bd) == 1) {
+    return VOICE_MOTION_TYPE::OBLIQUE_MOTION;
+  }
+  else if (md == bd) {
+    return VOICE_MOTION_TYPE::PARALLEL_MOTION;
+  }
+  return VOICE_MOTION_TYPE::CONTRARY_MOTION;
+}
+
 unique_ptr<DISCRETE_DIST> ChordTranVoiceMotion(Piece *p) /*ORIGINAL*/ {
   /*
   The outer voice motion between two successive chords.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size()-1; i++) {
-    int md = sgn(p->chords[i+1].notes.back()->pitch - p->chords[i].notes.back()->pitch);
-    int bd = sgn(p->chords[i+1].notes[0]->pitch - p->chords[i].notes[0]->pitch);
-    if (abs(md) + abs(bd) == 0) {
-      (*d)[static_cast<uint64_t>(VOICE_MOTION_TYPE::NO_CHANGE)]++;
-    }
-    else if (abs(md) + abs(bd) == 1) {
-      (*d)[static_cast<uint64_t>(VOICE_MOTION_TYPE::OBLIQUE_MOTION)]++;
-    }
-    else if (abs(md) + abs(bd) == 2) {
-      if (md == bd) {
-        (*d)[static_cast<uint64_t>(VOICE_MOTION_TYPE::PARALLEL_MOTION)]++;
+  auto d = dense_dist<4>();
+  const auto &s = p->summaries;
+  for (int i=0; i<(int)s.size()-1; i++) {
+    (*d)[static_cast<uint64_t>(voice_motion(s[i], s[i+1]))]++;
+  }
+  return d;
+}
+
+// -1 if b is not entirely onsets of the same size as a, otherwise whether
+// b repeats the pitches of a
+int chord_repeat(const CHORD &a, const CHORD &b) {
+  bool allOnsets = (b.onset_count == b.size);
+  if ((allOnsets) && (a.size == b.size)) {
+    bool allMatch = true;
+    for (int j=0; j<a.size; j++) {
+      if (a.pitch[j] != b.pitch[j]) {
+        allMatch = false;
       }
-      else if (md != bd) {
-        (*d)[static_cast<uint64_t>(VOICE_MOTION_TYPE::CONTRARY_MOTION)]++;
-      } 
     }
+    return (int)allMatch;
   }
-  return d;
+  return -1;
 }
 
 unique_ptr<DISCRETE_DIST> ChordTranRepeat(Piece *p) /*ORIGINAL*/ {
   /*
   The frequency of complete chord repetition.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist<2>();
   for (int i=0; i<(int)p->chords.size()-1; i++) {
-    bool allOnsets = true;
-    for (const auto &note : p->chords[i+1].notes) {
-      if (note->onset < p->chords[i+1].onset) {
-        allOnsets = false;
-      }
-    }
-    if ((allOnsets) && (p->chords[i].notes.size() == p->chords[i+1].notes.size())) {
-      bool allMatch = true;
-      for (int j=0; j<(int)p->chords[i].notes.size(); j++) {
-        if (p->chords[i].notes[j]->pitch != p->chords[i+1].notes[j]->pitch) {
-          allMatch = false;
-        }
-      }
-      (*d)[(int)allMatch]++;
+    int repeat = chord_repeat(p->chords[i], p->chords[i+1]);
+    if (repeat >= 0) {
+      (*d)[repeat]++;
     }
   }
   return d;
@@ -393,17 +378,17 @@ unique_ptr<DISCRETE_DIST> ChordTranScaleDistance(Piece *p) /*ORIGINAL*/ {
   /*
   The distance in scale space between two successive chords.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size()-1; i++) {
-    int a = PCINT(p->chords[i].notes).value;
-    int b = PCINT(p->chords[i+1].notes).value;
+  auto d = dense_dist<101>();
+  for (int i=0; i<(int)p->summaries.size()-1; i++) {
+    int a = p->summaries[i].pc;
+    int b = p->summaries[i+1].pc;
     if (a == b) {
       (*d)[100]++;
     }
     else {
-      uint64_t data = (pcscale[a] ^ pcscale[b]);
+      uint64_t data = (pc_sets[a].scales ^ pc_sets[b].scales);
       (*d)[popcnt(&data, sizeof(uint64_t))]++;
-      //(*d)[__builtin_popcount(pcscale[a] ^ pcscale[b])]++;
+      //(*d)[__builtin_popcount(pc_sets[a].scales ^ pc_sets[b].scales)]++;
     }
   }
   return d;
@@ -413,17 +398,17 @@ unique_ptr<DISCRETE_DIST> ChordTranScaleUnion(Piece *p) /*ORIGINAL*/ {
   /*
   The distance in scale space between two successive chords.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size()-1; i++) {
-    int a = PCINT(p->chords[i].notes).value;
-    int b = PCINT(p->chords[i+1].notes).value;
+  auto d = dense_dist<101>();
+  for (int i=0; i<(int)p->summaries.size()-1; i++) {
+    int a = p->summaries[i].pc;
+    int b = p->summaries[i+1].pc;
     if (a == b) {
       (*d)[100]++;
     }
     else {
-      uint64_t data = (pcscale[a] | pcscale[b]);
+      uint64_t data = (pc_sets[a].scales | pc_sets[b].scales);
       (*d)[popcnt(&data, sizeof(uint64_t))]++;
-      //(*d)[__builtin_popcount(pcscale[a] | pcscale[b])]++;
+      //(*d)[__builtin_popcount(pc_sets[a].scales | pc_sets[b].scales)]++;
     }
   }
   return d;
@@ -433,10 +418,11 @@ unique_ptr<DISCRETE_DIST> ChordTranDistance(Piece *p) /*ORIGINAL*/ {
   /*
   The distance between the highest and lowest notes in successive chords
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size()-1; i++) {
-    int md = abs(p->chords[i+1].notes.back()->pitch - p->chords[i].notes.back()->pitch);
-    int bd = abs(p->chords[i+1].notes[0]->pitch - p->chords[i].notes[0]->pitch);
+  auto d = dense_dist<255>();
+  const auto &s = p->summaries;
+  for (int i=0; i<(int)s.size()-1; i++) {
+    int md = abs(s[i+1].top - s[i].top);
+    int bd = abs(s[i+1].bass - s[i].bass);
     (*d)[md + bd]++;
   }
   return d;
@@ -446,12 +432,14 @@ unique_ptr<DISCRETE_DIST> ChordTranOuter(Piece *p) /*ORIGINAL*/ {
   /*
   The pitch class transition using only the outer notes.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size()-1; i++) {
-    if ((p->chords[i+1].notes.front()->onset == p->chords[i+1].onset) || (p->chords[i+1].notes.back()->onset == p->chords[i+1].onset)) {
-      int a = mod(p->chords[i].notes.back()->pitch - p->chords[i].notes.front()->pitch, 12);
-      int b = mod(p->chords[i+1].notes.back()->pitch - p->chords[i+1].notes.front()->pitch, 12);
-      int c = mod(p->chords[i+1].notes.front()->pitch - p->chords[i].notes.front()->pitch, 12);
+  auto d = sparse_dist();
+  for (int i=0; i<(int)p->summaries.size()-1; i++) {
+    const CHORD_SUMMARY &prev = p->summaries[i];
+    const CHORD_SUMMARY &next = p->summaries[i+1];
+    if (next.bass_onset || next.top_onset) {
+      int a = mod(prev.range(), 12);
+      int b = mod(next.range(), 12);
+      int c = mod(next.bass - prev.bass, 12);
       (*d)[NOMINAL_TUPLE(a,b,c).value]++;
     }
   }
@@ -462,11 +450,11 @@ unique_ptr<DISCRETE_DIST> ChordTranBassInterval(Piece *p) /*ORIGINAL*/ {
   /*
   The absolute interval between the lowest note in successive chords.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist<12>();
   vector<int> bass;
-  for (const auto &chord : p->chords) {
-    if (chord.notes.front()->onset == chord.onset) {
-      bass.push_back(chord.notes.front()->pitch);
+  for (const auto &s : p->summaries) {
+    if (s.bass_onset) {
+      bass.push_back(s.bass);
     }
   }
   for (int i=0; i<(int)bass.size() - 2; i++) {
@@ -479,26 +467,26 @@ unique_ptr<DISCRETE_DIST> ChordTranMelodyInterval(Piece *p) /*ORIGINAL*/ {
   /*
   The absolute interval between the highest notes in successive chords.
   */
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   vector<int> melody;
-  for (const auto &chord : p->chords) {
-    if (chord.notes.back()->onset == chord.onset) {
-      melody.push_back(chord.notes.back()->pitch);
+  for (const auto &s : p->summaries) {
+    if (s.top_onset) {
+      melody.push_back(s.top);
     }
   }
 
   for (int i=0; i<(int)melody.size() - 5; i++) {
-    (*d)[pcd[PCINT(melody.begin() + i, melody.begin() + i + 5).value]]++;
+    (*d)[pc_sets[PCINT(melody.begin() + i, melody.begin() + i + 5).value].pcd]++;
   }
   return d;
 }
 
 unique_ptr<DISCRETE_DIST> ChordMelodyNgram(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   vector<int> melody;
-  for (const auto &chord : p->chords) {
-    if (chord.notes.back()->onset == chord.onset) {
-      melody.push_back(chord.notes.back()->pitch);
+  for (const auto &s : p->summaries) {
+    if (s.top_onset) {
+      melody.push_back(s.top);
     }
   }
   for (int i=0; i<(int)melody.size() - 4; i++) {
@@ -519,9 +507,9 @@ uint64_t roll_to_min(uint64_t x, int n) {
 }
 
 unique_ptr<DISCRETE_DIST> PCDTran(Piece *p) /*ORIGINAL*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (int i=0; i<(int)p->chords.size() - 1; i++) {
-    (*d)[ roll_to_min(PCINT(p->chords[i].notes).value + (PCINT(p->chords[i+1].notes).value << 12), 24)]++;
+  auto d = sparse_dist();
+  for (int i=0; i<(int)p->summaries.size() - 1; i++) {
+    (*d)[ roll_to_min(p->summaries[i].pc + (p->summaries[i+1].pc << 12), 24)]++;
   }
   return d;
 }
@@ -537,9 +525,9 @@ def chord_size_duration_weighted(p, resolution=8):
   return count([len(c) for c in p.chords], weights=p.chord_durs, max=2)
 */
 unique_ptr<DISCRETE_DIST> ChordSizeDurationWeighted(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[chord.notes.size()] += chord.duration;
+  auto d = dense_dist<MAX_CHORD_SIZE+1>();
+  for (const auto &s : p->summaries) {
+    (*d)[s.size] += s.duration;
   }
   return d;
 }
@@ -549,9 +537,9 @@ def offset_distribution(p, resolution=8):
   return count((p.onsets + p.durations) % (resolution*16), max=resolution*16)
 */
 unique_ptr<DISCRETE_DIST> OffsetDistrubution(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &note : p->notes) {
-    (*d)[clamp(mod(note->end, p->r*16), 0, p->r*16)]++;
+  auto d = dense_dist(p->r*16+1);
+  for (const auto &end : p->notes.end) {
+    (*d)[clamp(mod(end, p->r*16), 0, p->r*16)]++;
   }
   return d;
 }
@@ -561,9 +549,9 @@ def interval_distribution(p, resolution=8):
   return count(np.diff(p.pitches) + 128, max=256)
 */
 unique_ptr<DISCRETE_DIST> MelodicInterval(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (int i=0; i<(int)p->notes.size()-1; i++) {
-    (*d)[clamp((p->notes[i+1]->pitch - p->notes[i]->pitch), -128, 128)]++;
+    (*d)[clamp((p->notes.pitch[i+1] - p->notes.pitch[i]), -128, 128)]++;
   }
   return d;
 }
@@ -573,9 +561,9 @@ def duration_difference_distribution(p, resolution=8):
   return count(np.diff(p.durations) + resolution*16, max=resolution*32)
 */
 unique_ptr<DISCRETE_DIST> DurationDifference(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist(p->r*32+1);
   for (int i=0; i<(int)p->notes.size()-1; i++) {
-    (*d)[clamp(p->notes[i+1]->duration - p->notes[i]->duration + p->r*16, 0, p->r*32)]++;
+    (*d)[clamp(p->notes.duration[i+1] - p->notes.duration[i] + p->r*16, 0, p->r*32)]++;
   }
   return d;
 }
@@ -585,9 +573,9 @@ def onset_difference_distribution(p, resolution=8):
   return count(np.diff(p.onsets), max=resolution*16)
 */
 unique_ptr<DISCRETE_DIST> OnsetDifference(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = dense_dist(p->r*16+1);
   for (int i=0; i<(int)p->notes.size()-1; i++) {
-    (*d)[clamp(p->notes[i+1]->onset - p->notes[i]->onset, 0, p->r*16)]++;
+    (*d)[clamp(p->notes.onset[i+1] - p->notes.onset[i], 0, p->r*16)]++;
   }
   return d;
 }
@@ -597,9 +585,9 @@ def onset_distrubution(p, resolution=8):
   return count(p.onsets % (resolution*4), max=resolution*4)
 */
 unique_ptr<DISCRETE_DIST> Onset(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &note : p->notes) {
-    (*d)[clamp(mod(note->onset, p->r*4), 0, p->r*4)]++;
+  auto d = dense_dist(p->r*4+1);
+  for (const auto &onset : p->notes.onset) {
+    (*d)[clamp(mod(onset, p->r*4), 0, p->r*4)]++;
   }
   return d;
 }
@@ -609,9 +597,9 @@ def duration_distribution(p, resolution=8):
   return count(p.durations, max=resolution*16)
 */
 unique_ptr<DISCRETE_DIST> Duration(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &note : p->notes) {
-    (*d)[clamp(note->duration, 0, p->r*16)]++;
+  auto d = dense_dist(p->r*16+1);
+  for (const auto &duration : p->notes.duration) {
+    (*d)[clamp(duration, 0, p->r*16)]++;
   }
   return d;
 }
@@ -621,9 +609,9 @@ def melodic_ngram_pcd(p, resolution=8):
   return count([pcd[toInt(_)] for _ in window(p.pitches,4)], max=352)
 */
 unique_ptr<DISCRETE_DIST> MelodicNGramPCD(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+  auto d = sparse_dist();
   for (int i=0; i<(int)p->notes.size()-3; i++) {
-    (*d)[pcd[PCINT(p->notes.begin()+i, p->notes.begin()+i+4).value]]++;
+    (*d)[pc_sets[PCINT(p->notes.pitch.begin()+i, p->notes.pitch.begin()+i+4).value].pcd]++;
   }
   return d;
 }
@@ -636,10 +624,10 @@ def chord_durations(p, resolution=8):
   return count([d for d,c in zip(p.chord_durs, p.chords) if len(c)], max=resolution*16)
 */
 unique_ptr<DISCRETE_DIST> ChordDurationMirex(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    if (!chord.notes.empty()) {
-      (*d)[clamp(chord.duration,0,p->r*16)]++;
+  auto d = dense_dist(p->r*16+1);
+  for (const auto &s : p->summaries) {
+    if (s.size) {
+      (*d)[clamp((int)s.duration,0,p->r*16)]++;
     }
   }
   return d;
@@ -656,9 +644,9 @@ def chord_onset_difference_distribution(p, resolution=8):
   return count(np.diff(p.segments) + 128, max=256)
 */
 unique_ptr<DISCRETE_DIST> ChordOnsetDifference(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &it : zipper<CHORD>(p->chords)) {
-    (*d)[clamp(it.second.onset - it.first.onset + 128,0,256)]++;
+  auto d = dense_dist<257>();
+  for (int i=0; i<(int)p->summaries.size()-1; i++) {
+    (*d)[clamp(p->summaries[i+1].onset - p->summaries[i].onset + 128,0,256)]++;
   }
   return d;
 }
@@ -668,9 +656,9 @@ def pitch_distribution(p, resolution=8):
   return count(p.pitches, max=128)
 */
 unique_ptr<DISCRETE_DIST> Pitch(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &note : p->notes) {
-    (*d)[note->pitch]++;
+  auto d = dense_dist<128>();
+  for (const auto &pitch : p->notes.pitch) {
+    (*d)[pitch]++;
   }
   return d;
 }
@@ -722,9 +710,9 @@ def chord_outer_interval(p, resolution=8):
   return count([np.max(c)-np.min(c) % 12 if len(c) else 0 for c in p.chords], weights=p.chord_durs, max=12)
 */
 unique_ptr<DISCRETE_DIST> ChordOuterInterval(Piece *p) /*MIREX*/ {
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &chord : p->chords) {
-    (*d)[mod(chord.notes.back()->pitch - chord.notes[0]->pitch, 12)]++;
+  auto d = dense_dist<12>();
+  for (const auto &s : p->summaries) {
+    (*d)[mod(s.range(), 12)]++;
   }
   return d;
 }
@@ -741,25 +729,33 @@ def chord_distance(p, resolution=8):
     dist.append( int(np.round(float(inter) / union * (D-1))) )
   return count(dist, max=D)
 */
-unique_ptr<DISCRETE_DIST> ChordDistance(Piece *p) /*MIREX*/ {
+// -1 if the pitch sets of a and b are identical, otherwise their
+// quantized overlap
+int chord_distance(const CHORD &a, const CHORD &b) {
   int N = 25;
-  auto d = unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
-  for (const auto &it : zipper<CHORD>(p->chords)) {
-    float set_inter = 0;
-    float set_union = 0;
-    std::map<int,int> counts;
-    for (const auto &note : it.first.notes) {
-      counts[note->pitch] = 1;
-    }
-    for (const auto &note : it.second.notes) {
-      counts[note->pitch]++;
-    }
-    for (const auto &kv : counts) {
-      set_union += (int)(kv.second == 1);
-      set_inter += (int)(kv.second > 1);
-    }
-    if (set_union != 0) {
-      (*d)[(int)(set_inter / set_union * (N-1))]++;
+  // a pitch counts once for a, plus once for each time it appears in b
+  bitset<128> in_a, in_b, repeated_in_b;
+  for (int i=0; i<a.size; i++) {
+    in_a[a.pitch[i]] = true;
+  }
+  for (int i=0; i<b.size; i++) {
+    repeated_in_b[b.pitch[i]] = repeated_in_b[b.pitch[i]] | in_b[b.pitch[i]];
+    in_b[b.pitch[i]] = true;
+  }
+  float set_union = ((in_a & ~in_b) | (in_b & ~in_a & ~repeated_in_b)).count();
+  float set_inter = ((in_a & in_b) | (repeated_in_b & ~in_a)).count();
+  if (set_union != 0) {
+    return (int)(set_inter / set_union * (N-1));
+  }
+  return -1;
+}
+
+unique_ptr<DISCRETE_DIST> ChordDistance(Piece *p) /*MIREX*/ {
+  auto d = dense_dist<25>();
+  for (int i=0; i<(int)p->chords.size()-1; i++) {
+    int distance = chord_distance(p->chords[i], p->chords[i+1]);
+    if (distance >= 0) {
+      (*d)[distance]++;
     }
   }
   return d;
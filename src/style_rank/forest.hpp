@@ -0,0 +1,355 @@
+#ifndef STYLE_RANK_FOREST_H
+#define STYLE_RANK_FOREST_H
+
+#include "thread_pool.hpp"
+
+#include <vector>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <assert.h>
+
+using namespace std;
+
+// a random forest specialized for the rf_embed workload. it mirrors
+// sklearn's RandomForestClassifier(criterion='entropy', bootstrap=True,
+// class_weight='balanced', max_features='sqrt') and only reports the leaf
+// each sample falls into, as that is all the embedding needs.
+
+static const double FOREST_FEATURE_THRESHOLD = 1e-7;
+static const double FOREST_EPSILON = 2.220446049250313e-16;
+
+uint64_t splitmix64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+// one feature matrix in compressed sparse column form, shared by all of its
+// trees. zeros are implicit, so the distributions of a large corpus take
+// memory in proportion to their non-zero counts, whichever form they are
+// given in.
+class FOREST_DATA {
+public:
+  size_t n, d;
+  int n_classes;
+  vector<size_t> colptr; // column j is [colptr[j], colptr[j+1])
+  vector<int32_t> rows; // ascending within each column
+  vector<float> values; // never zero
+  vector<int> labels;
+  vector<double> class_weight;
+
+  FOREST_DATA(const float *X, size_t _n, size_t _d, const vector<int> &y) {
+    assert(y.size() == _n);
+    n = _n;
+    d = _d;
+    colptr.assign(d + 1, 0);
+    for (size_t j=0; j<d; j++) {
+      for (size_t i=0; i<n; i++) {
+        if (X[i * d + j] != 0) {
+          rows.push_back(i);
+          values.push_back(X[i * d + j]);
+        }
+      }
+      colptr[j + 1] = rows.size();
+    }
+    set_labels(y);
+  }
+
+  // from a csr matrix with sorted or unsorted (but in range) indices.
+  // duplicate entries are summed, as scipy does.
+  FOREST_DATA(const float *X, const int32_t *indices, const int32_t *indptr, size_t _n, size_t _d, const vector<int> &y) {
+    assert(y.size() == _n);
+    n = _n;
+    d = _d;
+    // place the entries by column, visiting rows in order so each column
+    // is sorted and duplicates are adjacent
+    vector<size_t> next(d + 1, 0);
+    for (int32_t k=0; k<indptr[n]; k++) {
+      assert((indices[k] >= 0) && ((size_t)indices[k] < d));
+      next[indices[k] + 1]++;
+    }
+    partial_sum(next.begin(), next.end(), next.begin());
+    vector<int32_t> placed_rows(indptr[n]);
+    vector<float> placed_values(indptr[n]);
+    for (size_t i=0; i<n; i++) {
+      for (int32_t k=indptr[i]; k<indptr[i+1]; k++) {
+        size_t at = next[indices[k]]++;
+        placed_rows[at] = i;
+        placed_values[at] = X[k];
+      }
+    }
+    colptr.assign(d + 1, 0);
+    size_t begin = 0;
+    for (size_t j=0; j<d; j++) {
+      size_t end = next[j];
+      for (size_t k=begin; k<end; ) {
+        float v = 0;
+        size_t r = placed_rows[k];
+        for (; (k<end) && ((size_t)placed_rows[k] == r); k++) {
+          v += placed_values[k];
+        }
+        if (v != 0) {
+          rows.push_back(r);
+          values.push_back(v);
+        }
+      }
+      colptr[j + 1] = rows.size();
+      begin = end;
+    }
+    set_labels(y);
+  }
+
+  float get(size_t i, size_t j) const {
+    auto first = rows.begin() + colptr[j];
+    auto last = rows.begin() + colptr[j + 1];
+    auto it = lower_bound(first, last, (int32_t)i);
+    return ((it != last) && ((size_t)*it == i)) ? values[it - rows.begin()] : 0.f;
+  }
+
+private:
+  void set_labels(const vector<int> &y) {
+    labels = y;
+    // balanced class weights : n_samples / (n_classes * bincount(y))
+    n_classes = y.empty() ? 0 : *max_element(y.begin(), y.end()) + 1;
+    vector<size_t> counts(n_classes, 0);
+    for (const auto &label : y) {
+      assert(label >= 0);
+      counts[label]++;
+    }
+    int present = count_if(counts.begin(), counts.end(), [](size_t c){return c > 0;});
+    class_weight.resize(n_classes, 0.);
+    for (int k=0; k<n_classes; k++) {
+      if (counts[k] > 0) {
+        class_weight[k] = (double)n / (present * counts[k]);
+      }
+    }
+  }
+};
+
+class TREE_NODE {
+public:
+  int feature = -1; // -1 for leaves
+  double threshold = 0;
+  int left = -1;
+  int right = -1;
+  int leaf = -1;
+};
+
+double weighted_entropy(const double *w, int n_classes, double total) {
+  double h = 0;
+  for (int k=0; k<n_classes; k++) {
+    if (w[k] > 0) {
+      double p = w[k] / total;
+      h -= p * log2(p);
+    }
+  }
+  return h;
+}
+
+class DECISION_TREE {
+public:
+  vector<TREE_NODE> nodes;
+  int n_leaves = 0;
+
+  void fit(const FOREST_DATA &data, int max_depth, mt19937_64 &rng) {
+    nodes.clear();
+    n_leaves = 0;
+    size_t n = data.n;
+    int K = data.n_classes;
+    if (n == 0) return;
+
+    // draw the bootstrap sample as per-sample counts
+    vector<int> counts(n, 0);
+    uniform_int_distribution<size_t> pick(0, n - 1);
+    for (size_t i=0; i<n; i++) {
+      counts[pick(rng)]++;
+    }
+    vector<int> samples;
+    vector<double> weight(n, 0.);
+    for (size_t i=0; i<n; i++) {
+      if (counts[i] > 0) {
+        samples.push_back(i);
+        weight[i] = counts[i] * data.class_weight[data.labels[i]];
+      }
+    }
+
+    int max_features = max(1, (int)sqrt((double)data.d));
+    vector<int> features(data.d);
+    vector<pair<float,int>> values;
+    vector<double> total(K), left(K), zeros(K);
+    vector<int> node_of(n, -1); // the node each bootstrapped sample is at
+
+    struct RECORD { size_t begin, end; int depth, node; };
+    vector<RECORD> stack;
+    nodes.push_back(TREE_NODE());
+    stack.push_back({0, samples.size(), 0, 0});
+
+    while (!stack.empty()) {
+      RECORD r = stack.back();
+      stack.pop_back();
+
+      fill(total.begin(), total.end(), 0.);
+      for (size_t s=r.begin; s<r.end; s++) {
+        total[data.labels[samples[s]]] += weight[samples[s]];
+        node_of[samples[s]] = r.node;
+      }
+      double wtotal = accumulate(total.begin(), total.end(), 0.);
+
+      bool is_leaf = (r.depth >= max_depth) || (r.end - r.begin < 2) ||
+        (weighted_entropy(total.data(), K, wtotal) <= FOREST_EPSILON);
+
+      int best_feature = -1;
+      double best_threshold = 0;
+      double best_proxy = -INFINITY;
+
+      if (!is_leaf) {
+        iota(features.begin(), features.end(), 0);
+        int visited = 0;
+        int constant = 0;
+        size_t drawn = 0;
+        while ((drawn < data.d) && ((visited < max_features) || (visited <= constant))) {
+          // sample features without replacement
+          uniform_int_distribution<size_t> next(drawn, data.d - 1);
+          swap(features[drawn], features[next(rng)]);
+          int f = features[drawn++];
+          visited++;
+
+          // the samples at the node with a non-zero value. the rest are a
+          // single run of zeros, which stands in values as the sample -1.
+          values.clear();
+          size_t node_size = r.end - r.begin;
+          size_t column_size = data.colptr[f + 1] - data.colptr[f];
+          if (node_size * 8 < column_size) {
+            for (size_t s=r.begin; s<r.end; s++) {
+              float v = data.get(samples[s], f);
+              if (v != 0) values.push_back(make_pair(v, samples[s]));
+            }
+          }
+          else {
+            for (size_t k=data.colptr[f]; k<data.colptr[f + 1]; k++) {
+              if (node_of[data.rows[k]] == r.node) {
+                values.push_back(make_pair(data.values[k], data.rows[k]));
+              }
+            }
+          }
+          if (values.size() < node_size) {
+            zeros = total;
+            for (const auto &v : values) {
+              zeros[data.labels[v.second]] -= weight[v.second];
+            }
+            values.push_back(make_pair(0.f, -1));
+          }
+          sort(values.begin(), values.end());
+          if (values.back().first <= values.front().first + FOREST_FEATURE_THRESHOLD) {
+            constant++;
+            continue;
+          }
+
+          fill(left.begin(), left.end(), 0.);
+          double wleft = 0;
+          for (size_t k=0; k+1<values.size(); k++) {
+            if (values[k].second < 0) {
+              for (int c=0; c<K; c++) {
+                double w = max(zeros[c], 0.);
+                left[c] += w;
+                wleft += w;
+              }
+            }
+            else {
+              double w = weight[values[k].second];
+              left[data.labels[values[k].second]] += w;
+              wleft += w;
+            }
+            if (values[k+1].first <= values[k].first + FOREST_FEATURE_THRESHOLD) {
+              continue;
+            }
+            double wright = wtotal - wleft;
+            double hl = weighted_entropy(left.data(), K, wleft);
+            double hr = 0;
+            for (int c=0; c<K; c++) {
+              double wc = total[c] - left[c];
+              if (wc > 0) {
+                double p = wc / wright;
+                hr -= p * log2(p);
+              }
+            }
+            double proxy = -wleft * hl - wright * hr;
+            if (proxy > best_proxy) {
+              best_proxy = proxy;
+              best_feature = f;
+              best_threshold = values[k].first / 2.0 + values[k+1].first / 2.0;
+              if (best_threshold == values[k+1].first) {
+                best_threshold = values[k].first;
+              }
+            }
+          }
+        }
+        is_leaf = (best_feature < 0);
+      }
+
+      if (is_leaf) {
+        nodes[r.node].leaf = n_leaves++;
+        continue;
+      }
+
+      auto mid = partition(samples.begin() + r.begin, samples.begin() + r.end,
+        [&](int i){return data.get(i, best_feature) <= best_threshold;});
+      size_t split = mid - samples.begin();
+
+      int left_node = nodes.size();
+      nodes.push_back(TREE_NODE());
+      int right_node = nodes.size();
+      nodes.push_back(TREE_NODE());
+      nodes[r.node].feature = best_feature;
+      nodes[r.node].threshold = best_threshold;
+      nodes[r.node].left = left_node;
+      nodes[r.node].right = right_node;
+
+      // push right first so leaves are numbered depth first, left to right
+      stack.push_back({split, r.end, r.depth + 1, right_node});
+      stack.push_back({r.begin, split, r.depth + 1, left_node});
+    }
+  }
+
+  int apply(const FOREST_DATA &data, size_t i) const {
+    int node = 0;
+    while (nodes[node].feature >= 0) {
+      if (data.get(i, nodes[node].feature) <= nodes[node].threshold) {
+        node = nodes[node].left;
+      }
+      else {
+        node = nodes[node].right;
+      }
+    }
+    return nodes[node].leaf;
+  }
+};
+
+// train n_estimators trees on each feature matrix and return the leaf
+// index of every sample in every tree, as a row-major (n, n_estimators)
+// matrix per feature. trees are trained in parallel across all features,
+// and each tree is seeded from (seed, feature, tree) so the result does
+// not depend on num_threads.
+vector<vector<int>> forest_leaves(const vector<FOREST_DATA> &data, int n_estimators, int max_depth, uint64_t seed, int num_threads=0) {
+  vector<vector<int>> leaves(data.size());
+  for (size_t f=0; f<data.size(); f++) {
+    leaves[f].resize(data[f].n * n_estimators);
+  }
+  size_t n_tasks = data.size() * n_estimators;
+  parallel_for(n_tasks, num_threads, [&](size_t task, int) {
+    size_t f = task / n_estimators;
+    size_t t = task % n_estimators;
+    mt19937_64 rng(splitmix64(splitmix64(seed) ^ (f << 32) ^ t));
+    DECISION_TREE tree;
+    tree.fit(data[f], max_depth, rng);
+    for (size_t i=0; i<data[f].n; i++) {
+      leaves[f][i * n_estimators + t] = tree.apply(data[f], i);
+    }
+  });
+  return leaves;
+}
+
+#endif
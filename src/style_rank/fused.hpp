@@ -0,0 +1,376 @@
+#ifndef STYLE_RANK_FUSED_H
+#define STYLE_RANK_FUSED_H
+
+#include "utils.hpp"
+#include "parse.hpp"
+#include "features.hpp"
+#include "feature_map.hpp"
+#include "memo.hpp"
+
+#include <vector>
+#include <string>
+
+using namespace std;
+
+// computes many features in a single pass over Piece::chords (and one over
+// Piece::notes) instead of one pass per feature. the per-chord values that
+// several features share (pitch class sets, outer voices, onset flags) are
+// read from Piece::summaries, and a small window of previous chords and
+// melody/bass pitches serves the transition and n-gram features. the output
+// of each feature is identical to the corresponding function in
+// features.hpp. the features that depend only on the intervals of a chord
+// (or of a transition) are looked up in the CHORD_MEMO of the thread.
+
+enum FUSED_FEATURE {
+  F_IntervalDist,
+  F_IntervalClassDist,
+  F_ChordSize,
+  F_ChordPCSizeRatio,
+  F_ChordOnsetRatio,
+  F_ChordDistinctDurationRatio,
+  F_ChordDuration,
+  F_ChordShape,
+  F_ChordOnsetShape,
+  F_ChordPCD,
+  F_ChordPCDWBass,
+  F_ChordOnsetPCD,
+  F_ChordOnsetTiePCD,
+  F_ChordOnsetTiePCDTogether,
+  F_ChordTonnetz,
+  F_ChordOnset,
+  F_ChordRange,
+  F_ChordDissonance,
+  F_ChordTranDissonance,
+  F_ChordLowestInterval,
+  F_ChordSizeNgram,
+  F_ChordTranVoiceMotion,
+  F_ChordTranRepeat,
+  F_ChordTranScaleDistance,
+  F_ChordTranScaleUnion,
+  F_ChordTranDistance,
+  F_ChordTranOuter,
+  F_ChordTranBassInterval,
+  F_ChordTranMelodyInterval,
+  F_ChordMelodyNgram,
+  F_PCDTran,
+  F_ChordSizeDurationWeighted,
+  F_OffsetDistrubution,
+  F_MelodicInterval,
+  F_DurationDifference,
+  F_OnsetDifference,
+  F_Onset,
+  F_Duration,
+  F_MelodicNGramPCD,
+  F_ChordDurationMirex,
+  F_ChordOnsetDifference,
+  F_Pitch,
+  F_ChordOuterInterval,
+  F_ChordDistance,
+  N_FUSED_FEATURES
+};
+
+static unordered_map<string, int> fused_feature_ids {
+  { "IntervalDist", F_IntervalDist },
+  { "IntervalClassDist", F_IntervalClassDist },
+  { "ChordSize", F_ChordSize },
+  { "ChordPCSizeRatio", F_ChordPCSizeRatio },
+  { "ChordOnsetRatio", F_ChordOnsetRatio },
+  { "ChordDistinctDurationRatio", F_ChordDistinctDurationRatio },
+  { "ChordDuration", F_ChordDuration },
+  { "ChordShape", F_ChordShape },
+  { "ChordOnsetShape", F_ChordOnsetShape },
+  { "ChordPCD", F_ChordPCD },
+  { "ChordPCDWBass", F_ChordPCDWBass },
+  { "ChordOnsetPCD", F_ChordOnsetPCD },
+  { "ChordOnsetTiePCD", F_ChordOnsetTiePCD },
+  { "ChordOnsetTiePCDTogether", F_ChordOnsetTiePCDTogether },
+  { "ChordTonnetz", F_ChordTonnetz },
+  { "ChordOnset", F_ChordOnset },
+  { "ChordRange", F_ChordRange },
+  { "ChordDissonance", F_ChordDissonance },
+  { "ChordTranDissonance", F_ChordTranDissonance },
+  { "ChordLowestInterval", F_ChordLowestInterval },
+  { "ChordSizeNgram", F_ChordSizeNgram },
+  { "ChordTranVoiceMotion", F_ChordTranVoiceMotion },
+  { "ChordTranRepeat", F_ChordTranRepeat },
+  { "ChordTranScaleDistance", F_ChordTranScaleDistance },
+  { "ChordTranScaleUnion", F_ChordTranScaleUnion },
+  { "ChordTranDistance", F_ChordTranDistance },
+  { "ChordTranOuter", F_ChordTranOuter },
+  { "ChordTranBassInterval", F_ChordTranBassInterval },
+  { "ChordTranMelodyInterval", F_ChordTranMelodyInterval },
+  { "ChordMelodyNgram", F_ChordMelodyNgram },
+  { "PCDTran", F_PCDTran },
+  { "ChordSizeDurationWeighted", F_ChordSizeDurationWeighted },
+  { "OffsetDistrubution", F_OffsetDistrubution },
+  { "MelodicInterval", F_MelodicInterval },
+  { "DurationDifference", F_DurationDifference },
+  { "OnsetDifference", F_OnsetDifference },
+  { "Onset", F_Onset },
+  { "Duration", F_Duration },
+  { "MelodicNGramPCD", F_MelodicNGramPCD },
+  { "ChordDurationMirex", F_ChordDurationMirex },
+  { "ChordOnsetDifference", F_ChordOnsetDifference },
+  { "Pitch", F_Pitch },
+  { "ChordOuterInterval", F_ChordOuterInterval },
+  { "ChordDistance", F_ChordDistance }
+};
+
+static const int FUSED_NOTE_FEATURES[] = {
+  F_OffsetDistrubution, F_MelodicInterval, F_DurationDifference,
+  F_OnsetDifference, F_Onset, F_Duration, F_MelodicNGramPCD, F_Pitch
+};
+
+// the distribution for a fused feature, with the same domain kind as the
+// corresponding function in features.hpp
+unique_ptr<DISCRETE_DIST> fused_dist(int id, Piece *p) {
+  switch (id) {
+    case F_IntervalDist: return dense_dist<12>();
+    case F_IntervalClassDist: return dense_dist<7>();
+    case F_ChordSize: return dense_dist<MAX_CHORD_SIZE+1>();
+    case F_ChordTonnetz: return dense_dist<12>();
+    case F_ChordRange: return dense_dist<128>();
+    case F_ChordLowestInterval: return dense_dist<128>();
+    case F_ChordTranVoiceMotion: return dense_dist<4>();
+    case F_ChordTranRepeat: return dense_dist<2>();
+    case F_ChordTranScaleDistance: return dense_dist<101>();
+    case F_ChordTranScaleUnion: return dense_dist<101>();
+    case F_ChordTranDistance: return dense_dist<255>();
+    case F_ChordTranBassInterval: return dense_dist<12>();
+    case F_ChordSizeDurationWeighted: return dense_dist<MAX_CHORD_SIZE+1>();
+    case F_OffsetDistrubution: return dense_dist(p->r*16+1);
+    case F_DurationDifference: return dense_dist(p->r*32+1);
+    case F_OnsetDifference: return dense_dist(p->r*16+1);
+    case F_Onset: return dense_dist(p->r*4+1);
+    case F_Duration: return dense_dist(p->r*16+1);
+    case F_ChordDurationMirex: return dense_dist(p->r*16+1);
+    case F_ChordOnsetDifference: return dense_dist<257>();
+    case F_Pitch: return dense_dist<128>();
+    case F_ChordOuterInterval: return dense_dist<12>();
+    case F_ChordDistance: return dense_dist<25>();
+    default: return sparse_dist();
+  }
+}
+
+class FusedExtractor {
+public:
+  vector<string> feature_names;
+  vector<int> ids; // fused id for each name, or -1 if it is not fused
+  vector<int> stages; // the profile stage of each feature that is not fused
+  vector<bool> want;
+  bool want_chords;
+  bool want_notes;
+  int memo_groups; // the CHORD_MEMO_GROUPs the wanted features read
+
+  FusedExtractor(const vector<string> &names) {
+    feature_names = names;
+    want.resize(N_FUSED_FEATURES, false);
+    for (const auto &name : names) {
+      auto it = fused_feature_ids.find(name);
+      if (it == fused_feature_ids.end()) {
+        m.at(name); // throws for unknown features
+        ids.push_back(-1);
+        stages.push_back(profiler.stage("feature/" + name));
+      }
+      else {
+        ids.push_back(it->second);
+        stages.push_back(-1);
+        want[it->second] = true;
+      }
+    }
+    want_notes = false;
+    for (const auto &id : FUSED_NOTE_FEATURES) {
+      want_notes |= want[id];
+    }
+    want_chords = false;
+    for (int id=0; id<N_FUSED_FEATURES; id++) {
+      bool is_note = find(begin(FUSED_NOTE_FEATURES), end(FUSED_NOTE_FEATURES), id) != end(FUSED_NOTE_FEATURES);
+      want_chords |= (want[id] && !is_note);
+    }
+    memo_groups = 0;
+    if (want[F_IntervalDist] || want[F_IntervalClassDist]) memo_groups |= MEMO_INTERVALS;
+    if (want[F_ChordShape] || want[F_ChordOnsetShape] || want[F_ChordOnset]) memo_groups |= MEMO_SHAPES;
+    if (want[F_ChordDissonance]) memo_groups |= MEMO_DISSONANCE;
+  }
+
+  // returns one distribution per feature name, in the same order
+  vector<unique_ptr<DISCRETE_DIST>> operator()(Piece *p) const {
+    PROFILE_SCOPE scope(STAGE_FEATURES);
+    scope.count(1);
+    vector<unique_ptr<DISCRETE_DIST>> out(N_FUSED_FEATURES);
+    DISCRETE_DIST *d[N_FUSED_FEATURES] = {nullptr};
+    for (int id=0; id<N_FUSED_FEATURES; id++) {
+      if (want[id]) {
+        out[id] = fused_dist(id, p);
+        d[id] = out[id].get();
+      }
+    }
+    if (want_chords) {
+      PROFILE_SCOPE pass(STAGE_CHORD_PASS);
+      chord_pass(p, d);
+    }
+    if (want_notes) {
+      PROFILE_SCOPE pass(STAGE_NOTE_PASS);
+      note_pass(p, d);
+    }
+
+    vector<unique_ptr<DISCRETE_DIST>> ret;
+    for (int k=0; k<(int)ids.size(); k++) {
+      if (ids[k] < 0) {
+        PROFILE_SCOPE feature(stages[k]);
+        ret.push_back(m.at(feature_names[k])(p));
+      }
+      else if (out[ids[k]]) {
+        ret.push_back(move(out[ids[k]]));
+      }
+      else {
+        // the same feature was requested more than once
+        ret.push_back(unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST(*ret[find(ids.begin(), ids.end(), ids[k]) - ids.begin()])});
+      }
+    }
+    return ret;
+  }
+
+private:
+  void chord_pass(Piece *p, DISCRETE_DIST **d) const {
+    const vector<CHORD> &chords = p->chords;
+    const vector<CHORD_SUMMARY> &summaries = p->summaries;
+    vector<int> bass;
+    vector<int> melody;
+    CHORD_MEMO &memo = CHORD_MEMO::local();
+    CHORD_MEMO_STATS before = memo.stats;
+
+    for (int k=0; k<(int)chords.size(); k++) {
+      const CHORD &chord = chords[k];
+      const CHORD_SUMMARY &c = summaries[k];
+      const PC_SET &pcs = pc_sets[c.pc];
+      uint64_t dur = c.duration;
+
+      // single chord features
+      if (memo_groups) {
+        const CHORD_MEMO_ENTRY &e = memo.get(chord, memo_groups);
+        if (memo_groups & MEMO_INTERVALS) {
+          for (int interval=0; interval<12; interval++) {
+            if (!e.intervals[interval]) continue;
+            if (d[F_IntervalDist]) (*d[F_IntervalDist])[interval] += e.intervals[interval] * dur;
+            if (d[F_IntervalClassDist]) (*d[F_IntervalClassDist])[interval_class[interval]] += e.intervals[interval] * dur;
+          }
+        }
+        if (d[F_ChordShape]) (*d[F_ChordShape])[e.shape] += dur;
+        if (d[F_ChordOnsetShape]) (*d[F_ChordOnsetShape])[e.onset_pitch_shape] += dur;
+        if (d[F_ChordOnset]) (*d[F_ChordOnset])[e.onset_shape]++;
+        if (d[F_ChordDissonance] && (c.onset_count >= 2)) (*d[F_ChordDissonance])[e.dissonance] += dur;
+      }
+      if (d[F_ChordSize]) (*d[F_ChordSize])[c.size]++;
+      if (d[F_ChordPCSizeRatio]) (*d[F_ChordPCSizeRatio])[NOMINAL_TUPLE(pcs.size, c.size).value]++;
+      if (d[F_ChordOnsetRatio]) (*d[F_ChordOnsetRatio])[NOMINAL_TUPLE(c.onset_count, c.size).value]++;
+      if (d[F_ChordDistinctDurationRatio]) (*d[F_ChordDistinctDurationRatio])[NOMINAL_TUPLE(distinct_durations(p, chord), c.size).value]++;
+      if (d[F_ChordDuration]) (*d[F_ChordDuration])[rough_quantize(c.duration, p->ticks)]++;
+      if (d[F_ChordPCD]) (*d[F_ChordPCD])[pcs.pcd] += dur;
+      if (d[F_ChordPCDWBass]) (*d[F_ChordPCDWBass])[mod(c.bass,12) + (pcs.pcd << 12)] += dur;
+      if (d[F_ChordOnsetPCD]) (*d[F_ChordOnsetPCD])[pc_sets[c.onset_pc].pcd] += dur;
+      if (d[F_ChordOnsetTiePCD]) (*d[F_ChordOnsetTiePCD])[pc_sets[c.onset_pc].pcd + (pc_sets[c.tie_pc].pcd << 12)] += dur;
+      if (d[F_ChordOnsetTiePCDTogether]) (*d[F_ChordOnsetTiePCDTogether])[onset_tie_pcd_together(c)] += dur;
+      if (d[F_ChordTonnetz]) (*d[F_ChordTonnetz])[pcs.tonnetz] += dur;
+      if (d[F_ChordRange]) (*d[F_ChordRange])[c.range()]++;
+      if (d[F_ChordLowestInterval] && (c.size > 1)) {
+        (*d[F_ChordLowestInterval])[c.second - c.bass]++;
+      }
+      if (d[F_ChordSizeDurationWeighted]) (*d[F_ChordSizeDurationWeighted])[c.size] += dur;
+      if (d[F_ChordDurationMirex]) (*d[F_ChordDurationMirex])[clamp((int)c.duration,0,p->r*16)]++;
+      if (d[F_ChordOuterInterval]) (*d[F_ChordOuterInterval])[mod(c.range(), 12)]++;
+
+      // trigram of chord sizes
+      if (d[F_ChordSizeNgram] && (k >= 2)) {
+        (*d[F_ChordSizeNgram])[NOMINAL_TUPLE(summaries[k-2].size, summaries[k-1].size, c.size).value]++;
+      }
+
+      // transitions from the previous chord
+      if (k >= 1) {
+        const CHORD &prev = chords[k-1];
+        const CHORD_SUMMARY &b = summaries[k-1];
+        if (d[F_ChordTranDissonance] && (b.size >= 2) && (c.size >= 2)) {
+          (*d[F_ChordTranDissonance])[memo.transition(prev, chord)]++;
+        }
+        if (d[F_ChordTranVoiceMotion]) (*d[F_ChordTranVoiceMotion])[static_cast<uint64_t>(voice_motion(b, c))]++;
+        if (d[F_ChordTranRepeat]) {
+          int repeat = chord_repeat(prev, chord);
+          if (repeat >= 0) (*d[F_ChordTranRepeat])[repeat]++;
+        }
+        if (d[F_ChordTranScaleDistance] || d[F_ChordTranScaleUnion]) {
+          if (b.pc == c.pc) {
+            if (d[F_ChordTranScaleDistance]) (*d[F_ChordTranScaleDistance])[100]++;
+            if (d[F_ChordTranScaleUnion]) (*d[F_ChordTranScaleUnion])[100]++;
+          }
+          else {
+            uint64_t diff = (pc_sets[b.pc].scales ^ pcs.scales);
+            uint64_t both = (pc_sets[b.pc].scales | pcs.scales);
+            if (d[F_ChordTranScaleDistance]) (*d[F_ChordTranScaleDistance])[popcnt(&diff, sizeof(uint64_t))]++;
+            if (d[F_ChordTranScaleUnion]) (*d[F_ChordTranScaleUnion])[popcnt(&both, sizeof(uint64_t))]++;
+          }
+        }
+        if (d[F_ChordTranDistance]) (*d[F_ChordTranDistance])[abs(c.top - b.top) + abs(c.bass - b.bass)]++;
+        if (d[F_ChordTranOuter] && (c.bass_onset || c.top_onset)) {
+          (*d[F_ChordTranOuter])[NOMINAL_TUPLE(mod(b.range(), 12), mod(c.range(), 12), mod(c.bass - b.bass, 12)).value]++;
+        }
+        if (d[F_PCDTran]) (*d[F_PCDTran])[roll_to_min(b.pc + (c.pc << 12), 24)]++;
+        if (d[F_ChordOnsetDifference]) (*d[F_ChordOnsetDifference])[clamp(c.onset - b.onset + 128,0,256)]++;
+        if (d[F_ChordDistance]) {
+          int distance = chord_distance(prev, chord);
+          if (distance >= 0) (*d[F_ChordDistance])[distance]++;
+        }
+      }
+
+      // the bass line excludes its final interval
+      if (c.bass_onset) {
+        bass.push_back(c.bass);
+        int j = bass.size();
+        if (d[F_ChordTranBassInterval] && (j >= 3)) {
+          (*d[F_ChordTranBassInterval])[mod(bass[j-2] - bass[j-3], 12)]++;
+        }
+      }
+
+      // the melody windows exclude the final window
+      if (c.top_onset) {
+        melody.push_back(c.top);
+        int j = melody.size();
+        if (d[F_ChordTranMelodyInterval] && (j >= 6)) {
+          (*d[F_ChordTranMelodyInterval])[pc_sets[PCINT(melody.end() - 6, melody.end() - 1).value].pcd]++;
+        }
+        if (d[F_ChordMelodyNgram] && (j >= 5)) {
+          int i = j - 5;
+          (*d[F_ChordMelodyNgram])[NOMINAL_TUPLE(mod(melody[i] - melody[i+1], 12), mod(melody[i+1] - melody[i+2], 12), mod(melody[i+2] - melody[i+3], 12)).value]++;
+        }
+      }
+    }
+    profiler.memo(memo.stats.lookups - before.lookups, memo.stats.hits - before.hits);
+  }
+
+  void note_pass(Piece *p, DISCRETE_DIST **d) const {
+    const int *pitch = p->notes.pitch.data();
+    const int *onset = p->notes.onset.data();
+    const int *duration = p->notes.duration.data();
+    const int *end = p->notes.end.data();
+    int n = p->notes.size();
+    for (int i=0; i<n; i++) {
+      if (d[F_OffsetDistrubution]) (*d[F_OffsetDistrubution])[clamp(mod(end[i], p->r*16), 0, p->r*16)]++;
+      if (d[F_Onset]) (*d[F_Onset])[clamp(mod(onset[i], p->r*4), 0, p->r*4)]++;
+      if (d[F_Duration]) (*d[F_Duration])[clamp(duration[i], 0, p->r*16)]++;
+      if (d[F_Pitch]) (*d[F_Pitch])[pitch[i]]++;
+      if (i+1 < n) {
+        if (d[F_MelodicInterval]) (*d[F_MelodicInterval])[clamp((pitch[i+1] - pitch[i]), -128, 128)]++;
+        if (d[F_DurationDifference]) (*d[F_DurationDifference])[clamp(duration[i+1] - duration[i] + p->r*16, 0, p->r*32)]++;
+        if (d[F_OnsetDifference]) (*d[F_OnsetDifference])[clamp(onset[i+1] - onset[i], 0, p->r*16)]++;
+      }
+      if (d[F_MelodicNGramPCD] && (i+3 < n)) {
+        int pc = 0;
+        for (int j=i; j<i+4; j++) {
+          pc |= (1 << mod(pitch[j], 12));
+        }
+        (*d[F_MelodicNGramPCD])[pc_sets[pc].pcd]++;
+      }
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef STYLE_RANK_MEMO_H
+#define STYLE_RANK_MEMO_H
+
+#include "parse.hpp"
+#include "features.hpp"
+#include "dissonance.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <stdint.h>
+
+using namespace std;
+
+// tonal music repeats a small vocabulary of chords, so the features that
+// depend only on the intervals of a chord and which of its notes are onsets
+// are computed once per distinct chord and looked up for every occurrence.
+// the same goes for the dissonance of a transition, which depends only on
+// the intervals of both chords from the bass of the first. each thread
+// keeps its own memo across pieces, so lookups never contend for a lock.
+// an extractor may want only some of the values, so they are computed by
+// group, the first time a group is asked for.
+
+enum CHORD_MEMO_GROUP {
+  MEMO_INTERVALS = 1, // IntervalDist, IntervalClassDist
+  MEMO_SHAPES = 2, // ChordShape, ChordOnsetShape, ChordOnset
+  MEMO_DISSONANCE = 4, // ChordDissonance
+};
+
+// distinct chords (and transitions) kept per thread, beyond which the memo
+// starts over
+static const size_t MAX_MEMO_CHORDS = 1 << 16;
+
+class CHORD_MEMO_ENTRY {
+public:
+  int computed = 0; // the CHORD_MEMO_GROUPs that are filled in
+  uint32_t intervals[12]; // pairs of notes, by pitch class interval
+  uint64_t shape;
+  uint64_t onset_pitch_shape;
+  uint64_t onset_shape;
+  int dissonance; // of the onsets, if there are at least two
+};
+
+class CHORD_MEMO_STATS {
+public:
+  uint64_t lookups = 0;
+  uint64_t hits = 0; // lookups that computed nothing
+  uint64_t evictions = 0; // times the memo started over
+};
+
+class CHORD_MEMO {
+public:
+  CHORD_MEMO_STATS stats;
+
+  // the memo of the calling thread
+  static CHORD_MEMO &local() {
+    static thread_local CHORD_MEMO memo;
+    return memo;
+  }
+
+  // the values of the groups for a chord, which stay valid until the next
+  // call
+  const CHORD_MEMO_ENTRY &get(const CHORD &chord, int groups) {
+    // one byte per note, as its interval above the bass with the onset
+    // flag above it
+    key.resize(chord.size);
+    for (int i=0; i<chord.size; i++) {
+      key[i] = (char)((chord.pitch[i] - chord.bass()) | (chord.is_onset(i) << 7));
+    }
+    stats.lookups++;
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+      if (entries.size() >= MAX_MEMO_CHORDS) {
+        entries.clear();
+        stats.evictions++;
+      }
+      it = entries.emplace(key, CHORD_MEMO_ENTRY()).first;
+    }
+    CHORD_MEMO_ENTRY &e = it->second;
+    int missing = groups & ~e.computed;
+    if (!missing) {
+      stats.hits++;
+      return e;
+    }
+    if (missing & MEMO_INTERVALS) {
+      fill(e.intervals, e.intervals + 12, 0);
+      for (int j=0; j<chord.size; j++) {
+        for (int i=j+1; i<chord.size; i++) {
+          e.intervals[mod(chord.pitch[i] - chord.pitch[j], 12)]++;
+        }
+      }
+    }
+    if (missing & MEMO_SHAPES) {
+      e.shape = pitch_shape(chord);
+      e.onset_pitch_shape = pitch_shape(chord, ONSET_NOTES);
+      e.onset_shape = onset_shape(chord);
+    }
+    if (missing & MEMO_DISSONANCE) {
+      e.dissonance = (chord.onset_count >= 2) ? periodicity(chord, ONSET_NOTES, chord, ONSET_NOTES) : 0;
+    }
+    e.computed |= missing;
+    return e;
+  }
+
+  // the periodicity of the transition from a to b (ChordTranDissonance)
+  int transition(const CHORD &a, const CHORD &b) {
+    // the size of a, then one byte per note of a and b, as its interval
+    // above (or below) the bass of a
+    key.resize(2 + a.size + b.size);
+    key[0] = (char)(a.size & 0xff);
+    key[1] = (char)(a.size >> 8);
+    for (int i=0; i<a.size; i++) {
+      key[2 + i] = (char)(a.pitch[i] - a.bass());
+    }
+    for (int j=0; j<b.size; j++) {
+      key[2 + a.size + j] = (char)(b.pitch[j] - a.bass() + 128);
+    }
+    stats.lookups++;
+    auto it = transitions.find(key);
+    if (it != transitions.end()) {
+      stats.hits++;
+      return it->second;
+    }
+    if (transitions.size() >= MAX_MEMO_CHORDS) {
+      transitions.clear();
+      stats.evictions++;
+    }
+    int value = periodicity(a, ALL_NOTES, b, ALL_NOTES);
+    transitions.emplace(key, value);
+    return value;
+  }
+
+  // the distinct chords and transitions
+  size_t size() const {
+    return entries.size() + transitions.size();
+  }
+
+  void clear() {
+    entries.clear();
+    transitions.clear();
+    stats = CHORD_MEMO_STATS();
+  }
+
+private:
+  string key;
+  unordered_map<string,CHORD_MEMO_ENTRY> entries;
+  unordered_map<string,int> transitions;
+};
+
+#endif
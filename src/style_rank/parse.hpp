@@ -10,9 +10,11 @@
 #include <map>
 #include <set>
 #include <stack>
+#include <climits>
+#include <stdexcept>
 
-#include "./deps/MidiFile.h"
 #include "utils.hpp"
+#include "smf.hpp"
 
 using namespace std;
 
@@ -23,47 +25,192 @@ int quantize(int x, int ticks_per_beat, int resolution) {
   return (int)round((double)x / ticks_per_beat * resolution);
 }
 
-class NOTE {
+// the notes of a piece as parallel arrays, in the order they were read
+class NOTE_ARRAY {
 public:
-  int pitch, duration, velocity, onset, end;
-  NOTE(int pit, int ons, int dur, int vel) {
+  vector<int> pitch, onset, duration, velocity, end;
+
+  void push_back(int pit, int ons, int dur, int vel) {
     assert(pit >= 0);
     assert(pit < 128);
     assert(dur > 0);
     assert(ons >= 0);
     assert(vel >= 0);
-    pitch = pit;
-    duration = dur;
-    velocity = vel;
-    onset = ons;
-    end = ons + dur;
+    pitch.push_back(pit);
+    onset.push_back(ons);
+    duration.push_back(dur);
+    velocity.push_back(vel);
+    end.push_back(ons + dur);
+  }
+  void reserve(size_t n) {
+    pitch.reserve(n);
+    onset.reserve(n);
+    duration.reserve(n);
+    velocity.reserve(n);
+    end.reserve(n);
+  }
+  size_t size() const {
+    return pitch.size();
+  }
+  bool empty() const {
+    return pitch.empty();
+  }
+};
+
+// notes held elsewhere (e.g. by a numpy array) as size rows of (pitch,
+// onset, duration, velocity), with ticks ticks per beat. they are read in
+// place by Piece.
+class NOTE_ROWS {
+public:
+  const int64_t *data;
+  size_t size;
+  int ticks;
+
+  NOTE_ROWS slice(size_t begin, size_t end) const {
+    return {data + 4 * begin, end - begin, ticks};
+  }
+};
+
+// a piano roll held elsewhere as size frames of 128 velocities, with ticks
+// frames per beat. 0 is silence, and each run of frames in which a pitch
+// is not silent is one note, with the velocity of its first frame.
+class PIANO_ROLL {
+public:
+  const uint8_t *data;
+  size_t size;
+  int ticks;
+
+  PIANO_ROLL slice(size_t begin, size_t end) const {
+    return {data + 128 * begin, end - begin, ticks};
+  }
+
+  // the notes as (pitch, onset, duration, velocity), by onset then pitch
+  vector<array<int,4>> notes() const {
+    vector<array<int,4>> ret;
+    int start[128], velocity[128];
+    fill(start, start + 128, -1);
+    for (size_t t=0; t<=size; t++) {
+      for (int p=0; p<128; p++) {
+        int v = (t < size) ? data[t * 128 + p] : 0;
+        if (v > 127) {
+          throw invalid_argument("piano roll velocities must be in [0,128)");
+        }
+        if (v && (start[p] < 0)) {
+          start[p] = t;
+          velocity[p] = v;
+        }
+        else if (!v && (start[p] >= 0)) {
+          ret.push_back({{p, start[p], (int)t - start[p], velocity[p]}});
+          start[p] = -1;
+        }
+      }
+    }
+    sort(ret.begin(), ret.end(), [](const array<int,4> &a, const array<int,4> &b) {
+      return (a[1] < b[1]) || ((a[1] == b[1]) && (a[0] < b[0]));
+    });
+    return ret;
   }
 };
 
+// which notes of a chord a feature looks at
+enum CHORD_NOTES {
+  ALL_NOTES,
+  ONSET_NOTES, // notes that start with the chord
+  TIE_NOTES, // notes held over from an earlier chord
+};
+
+// a chord is a span of the piece's flat chord buffers, which hold the
+// notes sounding in each segment sorted by pitch. bit i of the onset mask
+// (one word per 64 notes) is set when the i-th note starts with the chord.
 class CHORD {
 public:
-  vector<NOTE*> notes;
-  vector<NOTE*> onset_notes;
-  vector<NOTE*> tie_notes;
+  int begin; // offset into Piece::chord_notes and Piece::chord_pitches
+  int size;
+  int mask; // offset into Piece::chord_onsets
+  int onset_count;
   int duration;
   int onset;
-  CHORD(vector<NOTE*> x, int _duration, int _onset) {
-    sort(x.begin(), x.end(), [](NOTE *a, NOTE *b){return a->pitch < b->pitch;});
-    copy(x.begin(), x.end(), back_inserter(notes));
-    copy_if(x.begin(), x.end(), back_inserter(onset_notes), [_onset](NOTE *a)   {return a->onset == _onset;} );
-    copy_if(x.begin(), x.end(), back_inserter(tie_notes), [_onset](NOTE *a){return a->onset != _onset;});
-    duration = _duration;
-    onset = _onset;
+
+  // views of the spans, bound once the piece is segmented
+  const int *note = nullptr;
+  const int *pitch = nullptr;
+  const uint64_t *onsets = nullptr;
+
+  bool empty() const {
+    return size == 0;
+  }
+  int bass() const {
+    return pitch[0];
+  }
+  int top() const {
+    return pitch[size-1];
+  }
+  bool is_onset(int i) const {
+    return (onsets[i >> 6] >> (i & 63)) & 1;
+  }
+  bool selected(int i, CHORD_NOTES which) const {
+    return (which == ALL_NOTES) || (is_onset(i) == (which == ONSET_NOTES));
+  }
+  int count(CHORD_NOTES which) const {
+    if (which == ALL_NOTES) return size;
+    return (which == ONSET_NOTES) ? onset_count : size - onset_count;
   }
   string __repr__() const {
     string repr = "CHORD [ ";
-    for (const auto &note : notes) {
-      repr += to_string(note->pitch) + " ";
+    for (int i=0; i<size; i++) {
+      repr += to_string(pitch[i]) + " ";
     }
     return repr + "]\n";
   }
 };
 
+// the facts about a chord that most features need, computed once when the
+// piece is segmented. they are stored contiguously in Piece::summaries,
+// parallel to Piece::chords, so a feature that needs nothing else is a
+// linear scan over a small array instead of a walk over the note spans.
+class CHORD_SUMMARY {
+public:
+  uint16_t pc; // the pitch class set of all notes
+  uint16_t onset_pc; // of the notes that start with the chord
+  uint16_t tie_pc; // of the notes held over from an earlier chord
+  uint16_t size;
+  uint16_t onset_count;
+  uint8_t bass;
+  uint8_t top;
+  uint8_t second; // the second lowest pitch, or the bass of a single note
+  bool bass_onset;
+  bool top_onset;
+  int32_t duration;
+  int32_t onset;
+
+  CHORD_SUMMARY(const CHORD &chord) {
+    onset_pc = 0;
+    tie_pc = 0;
+    for (int i=0; i<chord.size; i++) {
+      int bit = 1 << mod(chord.pitch[i], 12);
+      if (chord.is_onset(i)) {
+        onset_pc |= bit;
+      }
+      else {
+        tie_pc |= bit;
+      }
+    }
+    pc = onset_pc | tie_pc;
+    size = chord.size;
+    onset_count = chord.onset_count;
+    bass = chord.bass();
+    top = chord.top();
+    second = chord.pitch[chord.size > 1];
+    bass_onset = chord.is_onset(0);
+    top_onset = chord.is_onset(chord.size-1);
+    duration = chord.duration;
+    onset = chord.onset;
+  }
+  int range() const {
+    return top - bass;
+  }
+};
+
 class PCINT {
 public:
   int value;
@@ -78,16 +225,11 @@ public:
       value |= (1 << mod(*it, 12));
     }
   }
-  PCINT(vector<unique_ptr<NOTE>>::iterator b, vector<unique_ptr<NOTE>>::iterator e) {
-    value = 0;
-    for (auto it = b; it != e; it++) {
-      value |= (1 << mod((*it)->pitch, 12));
-    }
-  }
-  PCINT(const vector<NOTE*> &notes) {
+  PCINT(const CHORD &chord, CHORD_NOTES which=ALL_NOTES) {
     value = 0;
-    for (const auto &note : notes) {
-      value |= (1 << mod(note->pitch, 12));
+    for (int i=0; i<chord.size; i++) {
+      if (chord.selected(i, which))
+        value |= (1 << mod(chord.pitch[i], 12));
     }
   }
 };
@@ -95,15 +237,19 @@ public:
 class Piece {
 public:
 
-  multimap<int,NOTE*> stree;
-  multimap<int,NOTE*> etree;
-
-  set<int> onsets;
-  set<int> onsets_and_offsets;
+  // the distinct onsets, and onsets and offsets, in ascending order
+  vector<int> onsets;
+  vector<int> onsets_and_offsets;
 
   vector<CHORD> chords;
   vector<CHORD> chords_w_rests;
-  vector<unique_ptr<NOTE>> notes;
+  vector<CHORD_SUMMARY> summaries; // one per chord
+  NOTE_ARRAY notes;
+
+  // the buffers the chords are spans of
+  vector<int> chord_notes; // note indices
+  vector<int> chord_pitches;
+  vector<uint64_t> chord_onsets;
 
   int ticks;
   int track_count;
@@ -112,52 +258,112 @@ public:
 
   // this is for for testing
   Piece (vector<array<int,3>> &notes, bool include_offsets=false) {
-    max_duration = 0;
-    ticks = 1;
-    for (const auto &note : notes) {
-      if (note[2] > max_duration) {
-        max_duration = note[2];
+    track_count = 1;
+    setNotes(notes.size(), 1, 0, include_offsets, false, [&](size_t i) {
+      return array<int,4>{{notes[i][0], notes[i][1], notes[i][2], 100}};
+    });
+  }
+
+  // notes that were never a midi file, e.g. the output of a generative
+  // model. throws invalid_argument if a row is not a valid note.
+  Piece(const NOTE_ROWS &rows, int resolution=0, bool include_offsets=false) {
+    for (size_t i=0; i<rows.size; i++) {
+      const int64_t *n = rows.data + 4 * i;
+      if ((n[0] < 0) || (n[0] > 127) || (n[3] < 0) || (n[3] > 127)) {
+        throw invalid_argument("note pitches and velocities must be in [0,128)");
+      }
+      if ((n[1] < 0) || (n[2] < 0) || (n[1] + n[2] > INT_MAX)) {
+        throw invalid_argument("note onsets and durations must be non-negative ints");
       }
-      addNote(note[0], note[1], note[2]);
     }
-    findChords(include_offsets);
+    if (rows.ticks <= 0) {
+      throw invalid_argument("ticks per beat must be positive");
+    }
+    track_count = 1;
+    setNotes(rows.size, rows.ticks, resolution, include_offsets, false, [&](size_t i) {
+      const int64_t *n = rows.data + 4 * i;
+      return array<int,4>{{(int)n[0], (int)n[1], (int)n[2], (int)n[3]}};
+    });
+  }
+
+  Piece(const PIANO_ROLL &roll, int resolution=0, bool include_offsets=false) {
+    if (roll.ticks <= 0) {
+      throw invalid_argument("frames per beat must be positive");
+    }
+    vector<array<int,4>> rows = roll.notes();
+    track_count = 1;
+    setNotes(rows.size(), roll.ticks, resolution, include_offsets, false, [&](size_t i) {
+      return rows[i];
+    });
   }
 
+  // an empty piece, for loaders that fill in the buffers (see cache.hpp)
+  Piece() {
+    ticks = 0;
+    track_count = 0;
+    max_duration = 0;
+    r = 0;
+  }
+
+  // chords point into the piece's own buffers
+  Piece(const Piece&) = delete;
+  Piece& operator=(const Piece&) = delete;
+
   Piece(string filepath, int resolution=0, bool include_offsets=false, bool skip_chords=false) {
+    SMF_NOTES smf;
+    read_smf_notes(filepath, smf);
+    setNotes(smf, resolution, include_offsets, skip_chords);
+  }
 
-    smf::MidiFile midifile;
-    QUIET_CALL(midifile.read(filepath));
-    midifile.linkNotePairs();
-    track_count = midifile.getTrackCount();
-    ticks = midifile.getTicksPerQuarterNote();
+  // a midi file held in memory, which is read in place
+  Piece(const uint8_t *data, size_t size, int resolution=0, bool include_offsets=false, bool skip_chords=false) {
+    SMF_NOTES smf;
+    read_smf_notes(data, size, smf);
+    setNotes(smf, resolution, include_offsets, skip_chords);
+  }
+
+  // quantize and add the notes read from a midi file, then segment them
+  void setNotes(const SMF_NOTES &smf, int resolution, bool include_offsets, bool skip_chords) {
+    track_count = smf.track_count;
+    setNotes(smf.size(), smf.ticks, resolution, include_offsets, skip_chords, [&](size_t i) {
+      return array<int,4>{{smf.pitch[i], smf.onset[i], smf.duration[i], smf.velocity[i]}};
+    });
+  }
+
+  // quantize and add n notes, where note(i) is the (pitch, onset, duration,
+  // velocity) of the i-th, then segment them
+  template <typename F>
+  void setNotes(size_t n, int _ticks, int resolution, bool include_offsets, bool skip_chords, F note) {
+    ticks = _ticks;
     max_duration = 0;
     r = resolution;
     if (r==0) r=ticks;
 
     int pitch, duration, velocity, onset;
 
-    for (int track=0; track<track_count; track++) {
-      for (int event=0; event<midifile[track].size(); event++) {
-        if (midifile[track][event].isNoteOn()) {
-
-          pitch = (int)midifile[track][event][1];
-          duration = midifile[track][event].getTickDuration();
-          velocity = (int)midifile[track][event][2];
-          onset = midifile[track][event].tick;
-          assert(onset >= 0);
-
-          if (resolution != 0) {
-            duration = quantize(duration, ticks, r);
-            onset = quantize(onset, ticks, r);
-          }
+    {
+      PROFILE_SCOPE scope(STAGE_NOTES);
+      notes.reserve(n);
+      for (size_t i=0; i<n; i++) {
+        array<int,4> x = note(i);
+        pitch = x[0];
+        onset = x[1];
+        duration = x[2];
+        velocity = x[3];
+        assert(onset >= 0);
 
-          if (duration > max_duration) {
-            max_duration = duration;
-          }
+        if (resolution != 0) {
+          duration = quantize(duration, ticks, r);
+          onset = quantize(onset, ticks, r);
+        }
 
-          addNote(pitch, onset, duration, velocity);
+        if (duration > max_duration) {
+          max_duration = duration;
         }
+
+        addNote(pitch, onset, duration, velocity);
       }
+      scope.count(notes.size());
     }
     if (!skip_chords) {
       findChords(include_offsets);
@@ -166,60 +372,125 @@ public:
 
   void addNote(int pitch, int onset, int duration, int velocity=100) {
     if (duration <= 0) return;
+    notes.push_back(pitch, onset, duration, velocity);
+  }
+
+  void findBounds() {
+    onsets = notes.onset;
+    sort(onsets.begin(), onsets.end());
+    onsets.erase(unique(onsets.begin(), onsets.end()), onsets.end());
+    onsets_and_offsets = notes.onset;
+    onsets_and_offsets.insert(
+      onsets_and_offsets.end(), notes.end.begin(), notes.end.end());
+    sort(onsets_and_offsets.begin(), onsets_and_offsets.end());
+    onsets_and_offsets.erase(
+      unique(onsets_and_offsets.begin(), onsets_and_offsets.end()), 
+      onsets_and_offsets.end());
+  }
 
-    notes.push_back( 
-      unique_ptr<NOTE>(new NOTE(pitch, onset, duration, velocity)));
+  // append a chord from the sounding note indices, sorted by pitch
+  void addChord(const vector<int> &sounding, int duration, int onset) {
+    CHORD chord;
+    chord.begin = chord_notes.size();
+    chord.size = sounding.size();
+    chord.mask = chord_onsets.size();
+    chord.onset_count = 0;
+    chord.duration = duration;
+    chord.onset = onset;
+    chord_onsets.resize(chord.mask + (chord.size + 63) / 64, 0);
+    for (int i=0; i<chord.size; i++) {
+      int k = sounding[i];
+      chord_notes.push_back(k);
+      chord_pitches.push_back(notes.pitch[k]);
+      if (notes.onset[k] == onset) {
+        chord_onsets[chord.mask + (i >> 6)] |= (1ULL << (i & 63));
+        chord.onset_count++;
+      }
+    }
+    if (!chord.empty()) {
+      chords.push_back( chord );
+    }
+    else {
+      chords_w_rests.push_back( chord );
+    }
+  }
 
-    onsets.insert( onset );
-    onsets_and_offsets.insert( onset );
-    onsets_and_offsets.insert( onset + duration );
+  // the buffers are final once segmentation is done, so the chords can be
+  // bound to them and summarized
+  void bindChords() {
+    for (auto *list : {&chords, &chords_w_rests}) {
+      for (auto &chord : *list) {
+        chord.note = chord_notes.data() + chord.begin;
+        chord.pitch = chord_pitches.data() + chord.begin;
+        chord.onsets = chord_onsets.data() + chord.mask;
+      }
+    }
+    summaries.clear();
+    summaries.reserve(chords.size());
+    for (const auto &chord : chords) {
+      summaries.push_back(CHORD_SUMMARY(chord));
+    }
   }
 
+  // segment the piece with a single sweep over the boundaries. notes are
+  // sorted by onset once, and the set of sounding notes is carried from one
+  // boundary to the next, so each note is added and removed exactly once.
   void findChords(bool include_offsets) {
+    PROFILE_SCOPE scope(STAGE_CHORDS);
+    findBounds();
     if (notes.size() <= 0) return;
 
-    for (const auto &note : notes) {
-      stree.insert( make_pair(note->onset, note.get()) );
-      etree.insert( make_pair(note->end, note.get()) );
-    }
-
     vector<int> bounds;
     if (include_offsets) {
-      copy(
-        onsets_and_offsets.begin(), 
-        onsets_and_offsets.end(), 
-        back_inserter(bounds));
+      bounds = onsets_and_offsets;
     }
     else {
-      copy(onsets.begin(), onsets.end(), back_inserter(bounds));
-      bounds.push_back(*onsets_and_offsets.rbegin());
+      bounds = onsets;
+      bounds.push_back(onsets_and_offsets.back());
     }
 
+    vector<int> by_onset(notes.size());
+    iota(by_onset.begin(), by_onset.end(), 0);
+    stable_sort(by_onset.begin(), by_onset.end(), [this](int a, int b){
+      return notes.onset[a] < notes.onset[b];
+    });
+
+    // the sounding notes, ordered by (end, index). this is the order the
+    // previous end-time tree produced, which keeps the pitch sort below
+    // (and therefore every feature) identical for notes of equal pitch.
+    auto by_end = [this](int a, int b){
+      return (notes.end[a] < notes.end[b]) || 
+        ((notes.end[a] == notes.end[b]) && (a < b));
+    };
+    auto by_pitch = [this](int a, int b){
+      return notes.pitch[a] < notes.pitch[b];
+    };
+    vector<int> active;
+    vector<int> sounding;
+    size_t next = 0;
+
+    chords.reserve(bounds.size());
+    chord_notes.reserve(notes.size() * 2);
+    chord_pitches.reserve(notes.size() * 2);
+
     for (int i=0; i<(int)bounds.size() - 1; i++) {
+      int s = bounds[i];
       int length = bounds[i+1] - bounds[i];
-      auto notes = findOverlapping(bounds[i], bounds[i+1]);
-      auto chord = CHORD(notes, length, bounds[i]);
-      if (!notes.empty()) {
-        chords.push_back( chord );
-      }
-      else {
-        chords_w_rests.push_back( chord );
-      }
-    }
-  }
+      assert(length > 0);
 
-  // this is a faster way to find the notes belonging to
-  // a segment using the red-black trees
-  vector<NOTE*> findOverlapping(int s, int e) {
-    assert(s < e);
-    vector<NOTE*> notevec;
-    auto itend = etree.upper_bound(s+max_duration);
-    for (auto it = etree.upper_bound(s); it != itend; it++) {
-      if (it->second->onset <= s) {
-        notevec.push_back(it->second);
+      while ((next < by_onset.size()) && (notes.onset[by_onset[next]] <= s)) {
+        int k = by_onset[next++];
+        active.insert(upper_bound(active.begin(), active.end(), k, by_end), k);
       }
+      active.erase(active.begin(), find_if(active.begin(), active.end(), 
+        [this,s](int k){return notes.end[k] > s;}));
+
+      sounding = active;
+      sort(sounding.begin(), sounding.end(), by_pitch);
+      addChord(sounding, length, s);
     }
-    return notevec;
+    bindChords();
+    scope.count(chords.size());
   }
 };
 
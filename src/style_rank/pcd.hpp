@@ -1,13 +1,148 @@
 #ifndef STYLE_RANK_PCD_H
 #define STYLE_RANK_PCD_H
-static const uint64_t npcd = 4096;
-static const uint64_t pcd[4096] = {0, 1, 1, 3, 1, 5, 3, 7, 1, 9, 5, 11, 3, 13, 7, 15, 1, 17, 9, 19, 5, 21, 11, 23, 3, 25, 13, 27, 7, 29, 15, 31, 1, 33, 17, 35, 9, 37, 19, 39, 5, 41, 21, 43, 11, 45, 23, 47, 3, 49, 25, 51, 13, 53, 27, 55, 7, 57, 29, 59, 15, 61, 31, 63, 1, 65, 33, 67, 17, 69, 35, 71, 9, 73, 37, 75, 19, 77, 39, 79, 5, 81, 41, 83, 21, 85, 43, 87, 11, 89, 45, 91, 23, 93, 47, 95, 3, 97, 49, 99, 25, 101, 51, 103, 13, 105, 53, 107, 27, 109, 55, 111, 7, 113, 57, 115, 29, 117, 59, 119, 15, 121, 61, 123, 31, 125, 63, 127, 1, 33, 65, 97, 33, 133, 67, 135, 17, 137, 69, 139, 35, 141, 71, 143, 9, 145, 73, 147, 37, 149, 75, 151, 19, 153, 77, 155, 39, 157, 79, 159, 5, 133, 81, 163, 41, 165, 83, 167, 21, 169, 85, 171, 43, 173, 87, 175, 11, 177, 89, 179, 45, 181, 91, 183, 23, 185, 93, 187, 47, 189, 95, 191, 3, 67, 97, 195, 49, 197, 99, 199, 25, 201, 101, 203, 51, 205, 103, 207, 13, 209, 105, 211, 53, 213, 107, 215, 27, 217, 109, 219, 55, 221, 111, 223, 7, 135, 113, 227, 57, 229, 115, 231, 29, 233, 117, 235, 59, 237, 119, 239, 15, 241, 121, 243, 61, 245, 123, 247, 31, 249, 125, 251, 63, 253, 127, 255, 1, 17, 33, 49, 65, 81, 97, 113, 33, 145, 133, 177, 67, 209, 135, 241, 17, 273, 137, 275, 69, 277, 139, 279, 35, 281, 141, 283, 71, 285, 143, 287, 9, 137, 145, 291, 73, 293, 147, 295, 37, 297, 149, 299, 75, 301, 151, 303, 19, 275, 153, 307, 77, 309, 155, 311, 39, 313, 157, 315, 79, 317, 159, 319, 5, 69, 133, 197, 81, 325, 163, 327, 41, 329, 165, 331, 83, 333, 167, 335, 21, 277, 169, 339, 85, 341, 171, 343, 43, 345, 173, 347, 87, 349, 175, 351, 11, 139, 177, 355, 89, 357, 179, 359, 45, 361, 181, 363, 91, 365, 183, 367, 23, 279, 185, 371, 93, 373, 187, 375, 47, 377, 189, 379, 95, 381, 191, 383, 3, 35, 67, 99, 97, 163, 195, 227, 49, 291, 197, 355, 99, 397, 199, 399, 25, 281, 201, 403, 101, 405, 203, 407, 51, 409, 205, 411, 103, 413, 207, 415, 13, 141, 209, 397, 105, 421, 211, 423, 53, 425, 213, 427, 107, 429, 215, 431, 27, 283, 217, 435, 109, 437, 219, 439, 55, 441, 221, 443, 111, 445, 223, 447, 7, 71, 135, 199, 113, 327, 227, 455, 57, 457, 229, 459, 115, 461, 231, 463, 29, 285, 233, 467, 117, 469, 235, 471, 59, 473, 237, 475, 119, 477, 239, 479, 15, 143, 241, 399, 121, 485, 243, 487, 61, 489, 245, 491, 123, 493, 247, 495, 31, 287, 249, 499, 125, 501, 251, 503, 63, 505, 253, 507, 127, 509, 255, 511, 1, 9, 17, 25, 33, 41, 49, 57, 65, 73, 81, 89, 97, 105, 113, 121, 33, 137, 145, 153, 133, 169, 177, 185, 67, 201, 209, 217, 135, 233, 241, 249, 17, 145, 273, 281, 137, 297, 275, 313, 69, 329, 277, 345, 139, 361, 279, 377, 35, 291, 281, 409, 141, 425, 283, 441, 71, 457, 285, 473, 143, 489, 287, 505, 9, 73, 137, 201, 145, 329, 291, 457, 73, 585, 293, 587, 147, 589, 295, 591, 37, 293, 297, 595, 149, 597, 299, 599, 75, 587, 301, 603, 151, 605, 303, 607, 19, 147, 275, 403, 153, 613, 307, 615, 77, 589, 309, 619, 155, 621, 311, 623, 39, 295, 313, 627, 157, 629, 315, 631, 79, 591, 317, 635, 159, 637, 319, 639, 5, 37, 69, 101, 133, 165, 197, 229, 81, 293, 325, 357, 163, 421, 327, 485, 41, 297, 329, 613, 165, 661, 331, 663, 83, 595, 333, 667, 167, 669, 335, 671, 21, 149, 277, 405, 169, 661, 339, 679, 85, 597, 341, 683, 171, 685, 343, 687, 43, 299, 345, 691, 173, 693, 347, 695, 87, 599, 349, 699, 175, 701, 351, 703, 11, 75, 139, 203, 177, 331, 355, 459, 89, 587, 357, 715, 179, 717, 359, 719, 45, 301, 361, 723, 181, 725, 363, 727, 91, 603, 365, 731, 183, 733, 367, 735, 23, 151, 279, 407, 185, 663, 371, 743, 93, 605, 373, 747, 187, 749, 375, 751, 47, 303, 377, 755, 189, 757, 379, 759, 95, 607, 381, 763, 191, 765, 383, 767, 3, 19, 35, 51, 67, 83, 99, 115, 97, 147, 163, 179, 195, 211, 227, 243, 49, 275, 291, 307, 197, 339, 355, 371, 99, 403, 397, 435, 199, 467, 399, 499, 25, 153, 281, 409, 201, 595, 403, 627, 101, 613, 405, 691, 203, 723, 407, 755, 51, 307, 409, 819, 205, 821, 411, 823, 103, 615, 413, 827, 207, 829, 415, 831, 13, 77, 141, 205, 209, 333, 397, 461, 105, 589, 421, 717, 211, 845, 423, 847, 53, 309, 425, 821, 213, 853, 427, 855, 107, 619, 429, 859, 215, 861, 431, 863, 27, 155, 283, 411, 217, 667, 435, 871, 109, 621, 437, 875, 219, 877, 439, 879, 55, 311, 441, 823, 221, 885, 443, 887, 111, 623, 445, 891, 223, 893, 447, 895, 7, 39, 71, 103, 135, 167, 199, 231, 113, 295, 327, 359, 227, 423, 455, 487, 57, 313, 457, 615, 229, 679, 459, 743, 115, 627, 461, 871, 231, 925, 463, 927, 29, 157, 285, 413, 233, 669, 467, 925, 117, 629, 469, 939, 235, 941, 471, 943, 59, 315, 473, 827, 237, 949, 475, 951, 119, 631, 477, 955, 239, 957, 479, 959, 15, 79, 143, 207, 241, 335, 399, 463, 121, 591, 485, 719, 243, 847, 487, 975, 61, 317, 489, 829, 245, 981, 491, 983, 123, 635, 493, 987, 247, 989, 495, 991, 31, 159, 287, 415, 249, 671, 499, 927, 125, 637, 501, 1003, 251, 1005, 503, 1007, 63, 319, 505, 831, 253, 1013, 507, 1015, 127, 639, 509, 1019, 255, 1021, 511, 1023, 1, 5, 9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61, 65, 69, 73, 77, 81, 85, 89, 93, 97, 101, 105, 109, 113, 117, 121, 125, 33, 133, 137, 141, 145, 149, 153, 157, 133, 165, 169, 173, 177, 181, 185, 189, 67, 197, 201, 205, 209, 213, 217, 221, 135, 229, 233, 237, 241, 245, 249, 253, 17, 81, 145, 209, 273, 277, 281, 285, 137, 293, 297, 301, 275, 309, 313, 317, 69, 325, 329, 333, 277, 341, 345, 349, 139, 357, 361, 365, 279, 373, 377, 381, 35, 163, 291, 397, 281, 405, 409, 413, 141, 421, 425, 429, 283, 437, 441, 445, 71, 327, 457, 461, 285, 469, 473, 477, 143, 485, 489, 493, 287, 501, 505, 509, 9, 41, 73, 105, 137, 169, 201, 233, 145, 297, 329, 361, 291, 425, 457, 489, 73, 329, 585, 589, 293, 597, 587, 605, 147, 613, 589, 621, 295, 629, 591, 637, 37, 165, 293, 421, 297, 661, 595, 669, 149, 661, 597, 685, 299, 693, 599, 701, 75, 331, 587, 717, 301, 725, 603, 733, 151, 663, 605, 749, 303, 757, 607, 765, 19, 83, 147, 211, 275, 339, 403, 467, 153, 595, 613, 723, 307, 821, 615, 829, 77, 333, 589, 845, 309, 853, 619, 861, 155, 667, 621, 877, 311, 885, 623, 893, 39, 167, 295, 423, 313, 679, 627, 925, 157, 669, 629, 941, 315, 949, 631, 957, 79, 335, 591, 847, 317, 981, 635, 989, 159, 671, 637, 1005, 319, 1013, 639, 1021, 5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245, 81, 277, 293, 309, 325, 341, 357, 373, 163, 405, 421, 437, 327, 469, 485, 501, 41, 169, 297, 425, 329, 597, 613, 629, 165, 661, 661, 693, 331, 725, 663, 757, 83, 339, 595, 821, 333, 853, 667, 885, 167, 679, 669, 949, 335, 981, 671, 1013, 21, 85, 149, 213, 277, 341, 405, 469, 169, 597, 661, 725, 339, 853, 679, 981, 85, 341, 597, 853, 341, 1365, 683, 1367, 171, 683, 685, 1371, 343, 1367, 687, 1375, 43, 171, 299, 427, 345, 683, 691, 939, 173, 685, 693, 1387, 347, 1371, 695, 1391, 87, 343, 599, 855, 349, 1367, 699, 1399, 175, 687, 701, 1403, 351, 1375, 703, 1407, 11, 43, 75, 107, 139, 171, 203, 235, 177, 299, 331, 363, 355, 427, 459, 491, 89, 345, 587, 619, 357, 683, 715, 747, 179, 691, 717, 875, 359, 939, 719, 1003, 45, 173, 301, 429, 361, 685, 723, 941, 181, 693, 725, 1387, 363, 1387, 727, 1455, 91, 347, 603, 859, 365, 1371, 731, 1463, 183, 695, 733, 1467, 367, 1391, 735, 1471, 23, 87, 151, 215, 279, 343, 407, 471, 185, 599, 663, 727, 371, 855, 743, 983, 93, 349, 605, 861, 373, 1367, 747, 1495, 187, 699, 749, 1499, 375, 1399, 751, 1503, 47, 175, 303, 431, 377, 687, 755, 943, 189, 701, 757, 1455, 379, 1403, 759, 1519, 95, 351, 607, 863, 381, 1375, 763, 1527, 191, 703, 765, 1531, 383, 1407, 767, 1535, 3, 11, 19, 27, 35, 43, 51, 59, 67, 75, 83, 91, 99, 107, 115, 123, 97, 139, 147, 155, 163, 171, 179, 187, 195, 203, 211, 219, 227, 235, 243, 251, 49, 177, 275, 283, 291, 299, 307, 315, 197, 331, 339, 347, 355, 363, 371, 379, 99, 355, 403, 411, 397, 427, 435, 443, 199, 459, 467, 475, 399, 491, 499, 507, 25, 89, 153, 217, 281, 345, 409, 473, 201, 587, 595, 603, 403, 619, 627, 635, 101, 357, 613, 667, 405, 683, 691, 699, 203, 715, 723, 731, 407, 747, 755, 763, 51, 179, 307, 435, 409, 691, 819, 827, 205, 717, 821, 859, 411, 875, 823, 891, 103, 359, 615, 871, 413, 939, 827, 955, 207, 719, 829, 987, 415, 1003, 831, 1019, 13, 45, 77, 109, 141, 173, 205, 237, 209, 301, 333, 365, 397, 429, 461, 493, 105, 361, 589, 621, 421, 685, 717, 749, 211, 723, 845, 877, 423, 941, 847, 1005, 53, 181, 309, 437, 425, 693, 821, 949, 213, 725, 853, 1371, 427, 1387, 855, 1403, 107, 363, 619, 875, 429, 1387, 859, 1467, 215, 727, 861, 1499, 431, 1455, 863, 1531, 27, 91, 155, 219, 283, 347, 411, 475, 217, 603, 667, 731, 435, 859, 871, 987, 109, 365, 621, 877, 437, 1371, 875, 1499, 219, 731, 877, 1755, 439, 1463, 879, 1759, 55, 183, 311, 439, 441, 695, 823, 951, 221, 733, 885, 1463, 443, 1467, 887, 1775, 111, 367, 623, 879, 445, 1391, 891, 1783, 223, 735, 893, 1759, 447, 1471, 895, 1791, 7, 23, 39, 55, 71, 87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247, 113, 279, 295, 311, 327, 343, 359, 375, 227, 407, 423, 439, 455, 471, 487, 503, 57, 185, 313, 441, 457, 599, 615, 631, 229, 663, 679, 695, 459, 727, 743, 759, 115, 371, 627, 823, 461, 855, 871, 887, 231, 743, 925, 951, 463, 983, 927, 1015, 29, 93, 157, 221, 285, 349, 413, 477, 233, 605, 669, 733, 467, 861, 925, 989, 117, 373, 629, 885, 469, 1367, 939, 1399, 235, 747, 941, 1463, 471, 1495, 943, 1527, 59, 187, 315, 443, 473, 699, 827, 955, 237, 749, 949, 1467, 475, 1499, 951, 1783, 119, 375, 631, 887, 477, 1399, 955, 1911, 239, 751, 957, 1775, 479, 1503, 959, 1919, 15, 47, 79, 111, 143, 175, 207, 239, 241, 303, 335, 367, 399, 431, 463, 495, 121, 377, 591, 623, 485, 687, 719, 751, 243, 755, 847, 879, 487, 943, 975, 1007, 61, 189, 317, 445, 489, 701, 829, 957, 245, 757, 981, 1391, 491, 1455, 983, 1519, 123, 379, 635, 891, 493, 1403, 987, 1775, 247, 759, 989, 1783, 495, 1519, 991, 1983, 31, 95, 159, 223, 287, 351, 415, 479, 249, 607, 671, 735, 499, 863, 927, 991, 125, 381, 637, 893, 501, 1375, 1003, 1503, 251, 763, 1005, 1759, 503, 1527, 1007, 2015, 63, 191, 319, 447, 505, 703, 831, 959, 253, 765, 1013, 1471, 507, 1531, 1015, 1983, 127, 383, 639, 895, 509, 1407, 1019, 1919, 255, 767, 1021, 1791, 511, 1535, 1023, 2047, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 53, 55, 57, 59, 61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 89, 91, 93, 95, 97, 99, 101, 103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127, 33, 97, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159, 133, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189, 191, 67, 195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221, 223, 135, 227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253, 255, 17, 49, 81, 113, 145, 177, 209, 241, 273, 275, 277, 279, 281, 283, 285, 287, 137, 291, 293, 295, 297, 299, 301, 303, 275, 307, 309, 311, 313, 315, 317, 319, 69, 197, 325, 327, 329, 331, 333, 335, 277, 339, 341, 343, 345, 347, 349, 351, 139, 355, 357, 359, 361, 363, 365, 367, 279, 371, 373, 375, 377, 379, 381, 383, 35, 99, 163, 227, 291, 355, 397, 399, 281, 403, 405, 407, 409, 411, 413, 415, 141, 397, 421, 423, 425, 427, 429, 431, 283, 435, 437, 439, 441, 443, 445, 447, 71, 199, 327, 455, 457, 459, 461, 463, 285, 467, 469, 471, 473, 475, 477, 479, 143, 399, 485, 487, 489, 491, 493, 495, 287, 499, 501, 503, 505, 507, 509, 511, 9, 25, 41, 57, 73, 89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249, 145, 281, 297, 313, 329, 345, 361, 377, 291, 409, 425, 441, 457, 473, 489, 505, 73, 201, 329, 457, 585, 587, 589, 591, 293, 595, 597, 599, 587, 603, 605, 607, 147, 403, 613, 615, 589, 619, 621, 623, 295, 627, 629, 631, 591, 635, 637, 639, 37, 101, 165, 229, 293, 357, 421, 485, 297, 613, 661, 663, 595, 667, 669, 671, 149, 405, 661, 679, 597, 683, 685, 687, 299, 691, 693, 695, 599, 699, 701, 703, 75, 203, 331, 459, 587, 715, 717, 719, 301, 723, 725, 727, 603, 731, 733, 735, 151, 407, 663, 743, 605, 747, 749, 751, 303, 755, 757, 759, 607, 763, 765, 767, 19, 51, 83, 115, 147, 179, 211, 243, 275, 307, 339, 371, 403, 435, 467, 499, 153, 409, 595, 627, 613, 691, 723, 755, 307, 819, 821, 823, 615, 827, 829, 831, 77, 205, 333, 461, 589, 717, 845, 847, 309, 821, 853, 855, 619, 859, 861, 863, 155, 411, 667, 871, 621, 875, 877, 879, 311, 823, 885, 887, 623, 891, 893, 895, 39, 103, 167, 231, 295, 359, 423, 487, 313, 615, 679, 743, 627, 871, 925, 927, 157, 413, 669, 925, 629, 939, 941, 943, 315, 827, 949, 951, 631, 955, 957, 959, 79, 207, 335, 463, 591, 719, 847, 975, 317, 829, 981, 983, 635, 987, 989, 991, 159, 415, 671, 927, 637, 1003, 1005, 1007, 319, 831, 1013, 1015, 639, 1019, 1021, 1023, 5, 13, 21, 29, 37, 45, 53, 61, 69, 77, 85, 93, 101, 109, 117, 125, 133, 141, 149, 157, 165, 173, 181, 189, 197, 205, 213, 221, 229, 237, 245, 253, 81, 209, 277, 285, 293, 301, 309, 317, 325, 333, 341, 349, 357, 365, 373, 381, 163, 397, 405, 413, 421, 429, 437, 445, 327, 461, 469, 477, 485, 493, 501, 509, 41, 105, 169, 233, 297, 361, 425, 489, 329, 589, 597, 605, 613, 621, 629, 637, 165, 421, 661, 669, 661, 685, 693, 701, 331, 717, 725, 733, 663, 749, 757, 765, 83, 211, 339, 467, 595, 723, 821, 829, 333, 845, 853, 861, 667, 877, 885, 893, 167, 423, 679, 925, 669, 941, 949, 957, 335, 847, 981, 989, 671, 1005, 1013, 1021, 21, 53, 85, 117, 149, 181, 213, 245, 277, 309, 341, 373, 405, 437, 469, 501, 169, 425, 597, 629, 661, 693, 725, 757, 339, 821, 853, 885, 679, 949, 981, 1013, 85, 213, 341, 469, 597, 725, 853, 981, 341, 853, 1365, 1367, 683, 1371, 1367, 1375, 171, 427, 683, 939, 685, 1387, 1371, 1391, 343, 855, 1367, 1399, 687, 1403, 1375, 1407, 43, 107, 171, 235, 299, 363, 427, 491, 345, 619, 683, 747, 691, 875, 939, 1003, 173, 429, 685, 941, 693, 1387, 1387, 1455, 347, 859, 1371, 1463, 695, 1467, 1391, 1471, 87, 215, 343, 471, 599, 727, 855, 983, 349, 861, 1367, 1495, 699, 1499, 1399, 1503, 175, 431, 687, 943, 701, 1455, 1403, 1519, 351, 863, 1375, 1527, 703, 1531, 1407, 1535, 11, 27, 43, 59, 75, 91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251, 177, 283, 299, 315, 331, 347, 363, 379, 355, 411, 427, 443, 459, 475, 491, 507, 89, 217, 345, 473, 587, 603, 619, 635, 357, 667, 683, 699, 715, 731, 747, 763, 179, 435, 691, 827, 717, 859, 875, 891, 359, 871, 939, 955, 719, 987, 1003, 1019, 45, 109, 173, 237, 301, 365, 429, 493, 361, 621, 685, 749, 723, 877, 941, 1005, 181, 437, 693, 949, 725, 1371, 1387, 1403, 363, 875, 1387, 1467, 727, 1499, 1455, 1531, 91, 219, 347, 475, 603, 731, 859, 987, 365, 877, 1371, 1499, 731, 1755, 1463, 1759, 183, 439, 695, 951, 733, 1463, 1467, 1775, 367, 879, 1391, 1783, 735, 1759, 1471, 1791, 23, 55, 87, 119, 151, 183, 215, 247, 279, 311, 343, 375, 407, 439, 471, 503, 185, 441, 599, 631, 663, 695, 727, 759, 371, 823, 855, 887, 743, 951, 983, 1015, 93, 221, 349, 477, 605, 733, 861, 989, 373, 885, 1367, 1399, 747, 1463, 1495, 1527, 187, 443, 699, 955, 749, 1467, 1499, 1783, 375, 887, 1399, 1911, 751, 1775, 1503, 1919, 47, 111, 175, 239, 303, 367, 431, 495, 377, 623, 687, 751, 755, 879, 943, 1007, 189, 445, 701, 957, 757, 1391, 1455, 1519, 379, 891, 1403, 1775, 759, 1783, 1519, 1983, 95, 223, 351, 479, 607, 735, 863, 991, 381, 893, 1375, 1503, 763, 1759, 1527, 2015, 191, 447, 703, 959, 765, 1471, 1531, 1983, 383, 895, 1407, 1919, 767, 1791, 1535, 2047, 3, 7, 11, 15, 19, 23, 27, 31, 35, 39, 43, 47, 51, 55, 59, 63, 67, 71, 75, 79, 83, 87, 91, 95, 99, 103, 107, 111, 115, 119, 123, 127, 97, 135, 139, 143, 147, 151, 155, 159, 163, 167, 171, 175, 179, 183, 187, 191, 195, 199, 203, 207, 211, 215, 219, 223, 227, 231, 235, 239, 243, 247, 251, 255, 49, 113, 177, 241, 275, 279, 283, 287, 291, 295, 299, 303, 307, 311, 315, 319, 197, 327, 331, 335, 339, 343, 347, 351, 355, 359, 363, 367, 371, 375, 379, 383, 99, 227, 355, 399, 403, 407, 411, 415, 397, 423, 427, 431, 435, 439, 443, 447, 199, 455, 459, 463, 467, 471, 475, 479, 399, 487, 491, 495, 499, 503, 507, 511, 25, 57, 89, 121, 153, 185, 217, 249, 281, 313, 345, 377, 409, 441, 473, 505, 201, 457, 587, 591, 595, 599, 603, 607, 403, 615, 619, 623, 627, 631, 635, 639, 101, 229, 357, 485, 613, 663, 667, 671, 405, 679, 683, 687, 691, 695, 699, 703, 203, 459, 715, 719, 723, 727, 731, 735, 407, 743, 747, 751, 755, 759, 763, 767, 51, 115, 179, 243, 307, 371, 435, 499, 409, 627, 691, 755, 819, 823, 827, 831, 205, 461, 717, 847, 821, 855, 859, 863, 411, 871, 875, 879, 823, 887, 891, 895, 103, 231, 359, 487, 615, 743, 871, 927, 413, 925, 939, 943, 827, 951, 955, 959, 207, 463, 719, 975, 829, 983, 987, 991, 415, 927, 1003, 1007, 831, 1015, 1019, 1023, 13, 29, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253, 209, 285, 301, 317, 333, 349, 365, 381, 397, 413, 429, 445, 461, 477, 493, 509, 105, 233, 361, 489, 589, 605, 621, 637, 421, 669, 685, 701, 717, 733, 749, 765, 211, 467, 723, 829, 845, 861, 877, 893, 423, 925, 941, 957, 847, 989, 1005, 1021, 53, 117, 181, 245, 309, 373, 437, 501, 425, 629, 693, 757, 821, 885, 949, 1013, 213, 469, 725, 981, 853, 1367, 1371, 1375, 427, 939, 1387, 1391, 855, 1399, 1403, 1407, 107, 235, 363, 491, 619, 747, 875, 1003, 429, 941, 1387, 1455, 859, 1463, 1467, 1471, 215, 471, 727, 983, 861, 1495, 1499, 1503, 431, 943, 1455, 1519, 863, 1527, 1531, 1535, 27, 59, 91, 123, 155, 187, 219, 251, 283, 315, 347, 379, 411, 443, 475, 507, 217, 473, 603, 635, 667, 699, 731, 763, 435, 827, 859, 891, 871, 955, 987, 1019, 109, 237, 365, 493, 621, 749, 877, 1005, 437, 949, 1371, 1403, 875, 1467, 1499, 1531, 219, 475, 731, 987, 877, 1499, 1755, 1759, 439, 951, 1463, 1775, 879, 1783, 1759, 1791, 55, 119, 183, 247, 311, 375, 439, 503, 441, 631, 695, 759, 823, 887, 951, 1015, 221, 477, 733, 989, 885, 1399, 1463, 1527, 443, 955, 1467, 1783, 887, 1911, 1775, 1919, 111, 239, 367, 495, 623, 751, 879, 1007, 445, 957, 1391, 1519, 891, 1775, 1783, 1983, 223, 479, 735, 991, 893, 1503, 1759, 2015, 447, 959, 1471, 1983, 895, 1919, 1791, 2047, 7, 15, 23, 31, 39, 47, 55, 63, 71, 79, 87, 95, 103, 111, 119, 127, 135, 143, 151, 159, 167, 175, 183, 191, 199, 207, 215, 223, 231, 239, 247, 255, 113, 241, 279, 287, 295, 303, 311, 319, 327, 335, 343, 351, 359, 367, 375, 383, 227, 399, 407, 415, 423, 431, 439, 447, 455, 463, 471, 479, 487, 495, 503, 511, 57, 121, 185, 249, 313, 377, 441, 505, 457, 591, 599, 607, 615, 623, 631, 639, 229, 485, 663, 671, 679, 687, 695, 703, 459, 719, 727, 735, 743, 751, 759, 767, 115, 243, 371, 499, 627, 755, 823, 831, 461, 847, 855, 863, 871, 879, 887, 895, 231, 487, 743, 927, 925, 943, 951, 959, 463, 975, 983, 991, 927, 1007, 1015, 1023, 29, 61, 93, 125, 157, 189, 221, 253, 285, 317, 349, 381, 413, 445, 477, 509, 233, 489, 605, 637, 669, 701, 733, 765, 467, 829, 861, 893, 925, 957, 989, 1021, 117, 245, 373, 501, 629, 757, 885, 1013, 469, 981, 1367, 1375, 939, 1391, 1399, 1407, 235, 491, 747, 1003, 941, 1455, 1463, 1471, 471, 983, 1495, 1503, 943, 1519, 1527, 1535, 59, 123, 187, 251, 315, 379, 443, 507, 473, 635, 699, 763, 827, 891, 955, 1019, 237, 493, 749, 1005, 949, 1403, 1467, 1531, 475, 987, 1499, 1759, 951, 1775, 1783, 1791, 119, 247, 375, 503, 631, 759, 887, 1015, 477, 989, 1399, 1527, 955, 1783, 1911, 1919, 239, 495, 751, 1007, 957, 1519, 1775, 1983, 479, 991, 1503, 2015, 959, 1983, 1919, 2047, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 241, 287, 303, 319, 335, 351, 367, 383, 399, 415, 431, 447, 463, 479, 495, 511, 121, 249, 377, 505, 591, 607, 623, 639, 485, 671, 687, 703, 719, 735, 751, 767, 243, 499, 755, 831, 847, 863, 879, 895, 487, 927, 943, 959, 975, 991, 1007, 1023, 61, 125, 189, 253, 317, 381, 445, 509, 489, 637, 701, 765, 829, 893, 957, 1021, 245, 501, 757, 1013, 981, 1375, 1391, 1407, 491, 1003, 1455, 1471, 983, 1503, 1519, 1535, 123, 251, 379, 507, 635, 763, 891, 1019, 493, 1005, 1403, 1531, 987, 1759, 1775, 1791, 247, 503, 759, 1015, 989, 1527, 1783, 1919, 495, 1007, 1519, 1983, 991, 2015, 1983, 2047, 31, 63, 95, 127, 159, 191, 223, 255, 287, 319, 351, 383, 415, 447, 479, 511, 249, 505, 607, 639, 671, 703, 735, 767, 499, 831, 863, 895, 927, 959, 991, 1023, 125, 253, 381, 509, 637, 765, 893, 1021, 501, 1013, 1375, 1407, 1003, 1471, 1503, 1535, 251, 507, 763, 1019, 1005, 1531, 1759, 1791, 503, 1015, 1527, 1919, 1007, 1983, 2015, 2047, 63, 127, 191, 255, 319, 383, 447, 511, 505, 639, 703, 767, 831, 895, 959, 1023, 253, 509, 765, 1021, 1013, 1407, 1471, 1535, 507, 1019, 1531, 1791, 1015, 1919, 1983, 2047, 127, 255, 383, 511, 639, 767, 895, 1023, 509, 1021, 1407, 1535, 1019, 1791, 1919, 2047, 255, 511, 767, 1023, 1021, 1535, 1791, 2047, 511, 1023, 1535, 2047, 1023, 2047, 2047, 4095};
-static const uint64_t rot[4096] = {0, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 6, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 5, 5, 5, 5, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 6, 6, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 4, 4, 4, 4, 4, 4, 4, 4, 9, 4, 11, 4, 10, 4, 11, 4, 8, 0, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 6, 6, 6, 6, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 5, 5, 5, 5, 10, 5, 5, 5, 9, 5, 11, 5, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 7, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 6, 6, 6, 6, 10, 6, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 7, 7, 11, 7, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 0, 11, 0, 10, 0, 11, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 10, 3, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 7, 7, 3, 3, 10, 3, 11, 3, 9, 3, 11, 3, 10, 3, 11, 3, 8, 8, 11, 3, 10, 3, 11, 3, 9, 3, 11, 3, 10, 3, 11, 3, 6, 6, 6, 6, 10, 6, 11, 6, 9, 0, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 7, 7, 7, 7, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 11, 5, 8, 8, 11, 5, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 7, 7, 7, 7, 10, 7, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 6, 6, 6, 6, 10, 6, 11, 6, 9, 6, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 7, 7, 7, 7, 10, 7, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 4, 4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 10, 4, 4, 4, 9, 4, 11, 4, 10, 4, 11, 4, 7, 7, 7, 7, 10, 4, 11, 4, 9, 9, 11, 4, 10, 4, 11, 4, 8, 8, 11, 0, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 6, 6, 6, 6, 10, 6, 6, 6, 9, 6, 11, 6, 10, 0, 11, 0, 8, 8, 11, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 7, 7, 7, 7, 10, 7, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 8, 8, 11, 5, 10, 5, 11, 5, 9, 9, 11, 5, 10, 0, 11, 0, 7, 7, 7, 7, 10, 7, 11, 7, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 6, 6, 6, 6, 10, 6, 6, 6, 9, 6, 11, 6, 10, 6, 11, 0, 8, 8, 11, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 7, 7, 7, 7, 10, 7, 11, 7, 9, 9, 11, 0, 10, 0, 11, 0, 8, 8, 11, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 0, 11, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 8, 2, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 6, 6, 6, 6, 2, 2, 2, 2, 9, 2, 2, 2, 10, 2, 2, 2, 8, 2, 2, 2, 10, 2, 2, 2, 9, 2, 2, 2, 10, 2, 2, 2, 7, 7, 7, 2, 10, 2, 2, 2, 9, 2, 2, 2, 10, 2, 2, 2, 8, 8, 2, 2, 10, 2, 2, 2, 9, 2, 2, 2, 10, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 8, 8, 2, 2, 10, 2, 11, 2, 9, 2, 11, 2, 10, 2, 11, 2, 7, 7, 7, 7, 10, 2, 11, 2, 9, 9, 11, 2, 10, 2, 11, 2, 8, 8, 8, 2, 10, 2, 11, 2, 9, 9, 11, 2, 10, 2, 11, 2, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 11, 6, 10, 2, 11, 2, 8, 8, 8, 2, 10, 2, 11, 2, 9, 9, 11, 2, 10, 2, 11, 2, 7, 7, 7, 7, 10, 7, 11, 2, 9, 9, 11, 2, 10, 2, 11, 2, 8, 8, 8, 8, 10, 2, 11, 2, 9, 9, 11, 2, 10, 2, 11, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 4, 10, 4, 4, 4, 7, 7, 7, 7, 10, 4, 4, 4, 9, 4, 11, 4, 10, 4, 11, 4, 8, 8, 8, 4, 10, 4, 11, 4, 9, 9, 11, 4, 10, 4, 11, 4, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 11, 6, 8, 8, 8, 8, 10, 0, 11, 0, 9, 9, 11, 0, 10, 10, 11, 0, 7, 7, 7, 7, 10, 7, 11, 7, 9, 9, 11, 0, 10, 10, 11, 0, 8, 8, 8, 8, 10, 8, 11, 0, 9, 9, 11, 0, 10, 10, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 8, 8, 5, 5, 10, 5, 5, 5, 9, 9, 11, 5, 10, 5, 11, 5, 7, 7, 7, 7, 10, 7, 11, 7, 9, 9, 11, 5, 10, 10, 11, 0, 8, 8, 8, 8, 10, 8, 11, 0, 9, 9, 11, 0, 10, 10, 11, 0, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 11, 6, 8, 8, 8, 8, 10, 6, 11, 0, 9, 9, 11, 0, 10, 10, 11, 0, 7, 7, 7, 7, 10, 7, 11, 7, 9, 9, 11, 7, 10, 10, 11, 0, 8, 8, 8, 8, 10, 8, 11, 0, 9, 9, 11, 0, 10, 10, 11, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 10, 3, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 6, 6, 6, 6, 6, 6, 6, 6, 9, 3, 3, 3, 10, 3, 3, 3, 8, 8, 8, 3, 10, 3, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 7, 7, 7, 7, 10, 7, 3, 3, 9, 9, 11, 3, 10, 3, 11, 3, 8, 8, 8, 8, 10, 3, 11, 3, 9, 9, 11, 3, 10, 3, 11, 3, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 10, 5, 5, 5, 9, 9, 5, 5, 10, 5, 11, 5, 7, 7, 7, 7, 10, 7, 7, 7, 9, 9, 11, 3, 10, 3, 11, 3, 8, 8, 8, 8, 10, 8, 11, 3, 9, 9, 11, 3, 10, 10, 11, 3, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 11, 6, 8, 8, 8, 8, 10, 6, 11, 6, 9, 9, 11, 0, 10, 10, 11, 0, 7, 7, 7, 7, 10, 7, 7, 7, 9, 9, 11, 7, 10, 10, 11, 0, 8, 8, 8, 8, 10, 8, 11, 0, 9, 9, 11, 9, 10, 10, 11, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 10, 4, 4, 4, 9, 4, 4, 4, 10, 4, 4, 4, 8, 8, 8, 4, 10, 4, 4, 4, 9, 9, 11, 4, 10, 4, 11, 4, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 6, 6, 8, 8, 8, 8, 10, 4, 11, 4, 9, 9, 11, 4, 10, 4, 11, 4, 7, 7, 7, 7, 10, 7, 7, 7, 9, 9, 11, 7, 10, 10, 11, 4, 8, 8, 8, 8, 10, 8, 11, 0, 9, 9, 11, 9, 10, 10, 11, 0, 5, 5, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 10, 5, 5, 5, 9, 9, 5, 5, 10, 5, 5, 5, 7, 7, 7, 7, 10, 7, 7, 7, 9, 9, 11, 5, 10, 5, 11, 5, 8, 8, 8, 8, 10, 8, 11, 5, 9, 9, 11, 9, 10, 10, 11, 0, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 6, 6, 8, 8, 8, 8, 10, 6, 11, 6, 9, 9, 11, 6, 10, 10, 11, 0, 7, 7, 7, 7, 10, 7, 7, 7, 9, 9, 11, 7, 10, 10, 11, 7, 8, 8, 8, 8, 10, 8, 11, 8, 9, 9, 11, 9, 10, 10, 11, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 7, 7, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 6, 6, 6, 6, 6, 6, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 8, 8, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 7, 7, 7, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 8, 8, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 1, 1, 1, 1, 9, 1, 1, 1, 10, 1, 1, 1, 8, 8, 1, 1, 10, 1, 1, 1, 9, 1, 1, 1, 10, 1, 1, 1, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 1, 1, 10, 1, 1, 1, 8, 8, 8, 1, 10, 1, 1, 1, 9, 1, 1, 1, 10, 1, 1, 1, 7, 7, 7, 7, 7, 1, 1, 1, 9, 1, 1, 1, 10, 1, 1, 1, 8, 8, 8, 1, 10, 1, 1, 1, 9, 1, 1, 1, 10, 1, 1, 1, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 10, 5, 5, 5, 9, 1, 1, 1, 10, 1, 1, 1, 7, 7, 7, 7, 7, 7, 1, 1, 9, 9, 1, 1, 10, 1, 1, 1, 8, 8, 8, 1, 10, 1, 1, 1, 9, 9, 1, 1, 10, 1, 1, 1, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 1, 1, 8, 8, 8, 8, 10, 1, 1, 1, 9, 9, 1, 1, 10, 1, 1, 1, 7, 7, 7, 7, 7, 7, 7, 1, 9, 9, 1, 1, 10, 1, 1, 1, 8, 8, 8, 8, 10, 1, 1, 1, 9, 9, 1, 1, 10, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 6, 6, 6, 6, 6, 6, 6, 6, 9, 3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 10, 3, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 7, 7, 7, 7, 7, 7, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 8, 8, 8, 3, 10, 3, 3, 3, 9, 9, 3, 3, 10, 3, 3, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 1, 1, 10, 1, 11, 1, 8, 8, 8, 8, 10, 1, 11, 1, 9, 9, 9, 1, 10, 1, 11, 1, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 6, 6, 8, 8, 8, 8, 10, 6, 11, 1, 9, 9, 9, 1, 10, 1, 11, 1, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 1, 10, 1, 11, 1, 8, 8, 8, 8, 10, 8, 11, 1, 9, 9, 9, 1, 10, 1, 11, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 4, 10, 4, 4, 4, 9, 9, 4, 4, 10, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 6, 6, 8, 8, 8, 8, 10, 4, 4, 4, 9, 9, 9, 4, 10, 4, 11, 4, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 1, 11, 1, 8, 8, 8, 8, 10, 8, 11, 1, 9, 9, 9, 1, 10, 10, 11, 1, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 5, 5, 10, 5, 5, 5, 8, 8, 8, 8, 10, 8, 11, 5, 9, 9, 9, 1, 10, 10, 11, 1, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 10, 6, 6, 6, 8, 8, 8, 8, 10, 6, 6, 6, 9, 9, 9, 6, 10, 10, 11, 1, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 7, 11, 1, 8, 8, 8, 8, 10, 8, 11, 8, 9, 9, 9, 9, 10, 10, 11, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 6, 6, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 7, 7, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 8, 2, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 7, 7, 7, 7, 7, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 8, 8, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 2, 2, 2, 2, 8, 8, 8, 2, 10, 2, 2, 2, 9, 2, 2, 2, 10, 2, 2, 2, 7, 7, 7, 7, 7, 7, 7, 2, 9, 9, 2, 2, 10, 2, 2, 2, 8, 8, 8, 2, 10, 2, 2, 2, 9, 9, 2, 2, 10, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4, 4, 4, 9, 4, 4, 4, 10, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 2, 2, 2, 9, 9, 2, 2, 10, 2, 2, 2, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 2, 10, 2, 2, 2, 8, 8, 8, 8, 10, 2, 2, 2, 9, 9, 9, 2, 10, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 10, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 5, 5, 10, 5, 5, 5, 8, 8, 8, 8, 10, 8, 2, 2, 9, 9, 9, 2, 10, 2, 11, 2, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 6, 6, 6, 9, 9, 9, 6, 10, 2, 11, 2, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 7, 11, 2, 8, 8, 8, 8, 10, 8, 8, 2, 9, 9, 9, 9, 10, 10, 11, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 6, 6, 6, 6, 6, 6, 6, 6, 9, 3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 8, 8, 8, 3, 10, 3, 3, 3, 9, 3, 3, 3, 10, 3, 3, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 3, 3, 10, 3, 3, 3, 8, 8, 8, 8, 10, 3, 3, 3, 9, 9, 3, 3, 10, 3, 3, 3, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 6, 6, 6, 9, 9, 9, 3, 10, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 7, 3, 3, 8, 8, 8, 8, 10, 8, 8, 3, 9, 9, 9, 3, 10, 10, 11, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 4, 4, 4, 4, 4, 9, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 4, 4, 4, 9, 9, 4, 4, 10, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 4, 4, 4, 8, 8, 8, 8, 10, 8, 8, 4, 9, 9, 9, 4, 10, 4, 11, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 9, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 5, 5, 10, 5, 5, 5, 8, 8, 8, 8, 10, 8, 5, 5, 9, 9, 9, 5, 10, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 6, 6, 6, 9, 9, 9, 6, 10, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 7, 7, 10, 7, 7, 7, 8, 8, 8, 8, 10, 8, 8, 8, 9, 9, 9, 9, 10, 10, 11, 0};
-static const uint64_t iccount[4096] = {0, 0, 0, 256, 0, 65536, 256, 66048, 0, 16777216, 65536, 16843008, 256, 16843008, 66048, 16909056, 0, 4294967296, 16777216, 4311744768, 65536, 4295098368, 16843008, 4311876096, 256, 4311744768, 16843008, 4328587776, 66048, 4311876096, 16909056, 4328719360, 0, 1099511627776, 4294967296, 1103806595328, 16777216, 1099528470528, 4311744768, 1103823438336, 65536, 1099528470528, 4295098368, 1103823503616, 16843008, 1099545313536, 4311876096, 1103840346880, 256, 1103806595328, 4311744768, 1108118340096, 16843008, 1103823503616, 4328587776, 1108135248640, 66048, 1103823438336, 4311876096, 1108135248640, 16909056, 1103840346880, 4328719360, 1108152157440, 0, 281474976710656, 1099511627776, 282574488338688, 4294967296, 281479271743488, 1103806595328, 282578783371776, 16777216, 281475010265088, 1099528470528, 282574521958656, 4311744768, 281479305298176, 1103823438336, 282578816992000, 65536, 281479271743488, 1099528470528, 282578800148736, 4295098368, 281483566841856, 1103823503616, 282583095247360, 16843008, 281479305298176, 1099545313536, 282578833768960, 4311876096, 281483600396800, 1103840346880, 282583128867840, 256, 282574488338688, 1103806595328, 283678294934016, 4311744768, 282578800148736, 1108118340096, 283682606744320, 16843008, 282574521958656, 1103823503616, 283678328619520, 4328587776, 282578833768960, 1108135248640, 283682640430080, 66048, 282578783371776, 1103823438336, 283682606744320, 4311876096, 282583095247360, 1108135248640, 283686918620160, 16909056, 282578816992000, 1103840346880, 283682640430080, 4328719360, 282583128867840, 1108152157440, 283686952306176, 0, 1099511627776, 281474976710656, 282574488338688, 1099511627776, 2199023321088, 282574488338688, 283674000032256, 4294967296, 1103823372288, 281479271743488, 282578800148736, 1103806595328, 2203335065856, 282578783371776, 283678311842560, 16777216, 1103823372288, 281475010265088, 282578816860416, 1099528470528, 2203335131136, 282574521958656, 283678328619520, 4311744768, 1108135117056, 281479305298176, 282583128670720, 1103823438336, 2207646876160, 282578816992000, 283682640430080, 65536, 2199023321088, 281479271743488, 283678294999296, 1099528470528, 3298551791616, 282578800148736, 284777823470080, 4295098368, 2203335131136, 281483566841856, 283682606874880, 1103823503616, 3302863601920, 282583095247360, 284782135345920, 16843008, 2203335065856, 281479305298176, 283682623521280, 1099545313536, 3302863601920, 282578833768960, 284782152057600, 4311876096, 2207646876160, 281483600396800, 283686935397120, 1103840346880, 3307175412480, 282583128867840, 284786463933696, 256, 282574488338688, 282574488338688, 565148976677376, 1103806595328, 283678294999296, 283678294934016, 566252783338240, 4311744768, 282578816860416, 282578800148736, 565153305264640, 1108118340096, 283682623521280, 283682606744320, 566257111925760, 16843008, 282578800148736, 282574521958656, 565153305264640, 1103823503616, 283682606874880, 283678328619520, 566257111991040, 4328587776, 282583128670720, 282578833768960, 565157633852160, 1108135248640, 283686935397120, 283682640430080, 566261440578816, 66048, 283674000032256, 282578783371776, 566252783338240, 1103823438336, 284777823470080, 283682606744320, 567356606776320, 4311876096, 283678328619520, 282583095247360, 566257111991040, 1108135248640, 284782152057600, 283686918620160, 567360935429376, 16909056, 283678311842560, 282578816992000, 566257111925760, 1103840346880, 284782135345920, 283682640430080, 567360935429376, 4328719360, 283682640430080, 282583128867840, 566261440578816, 1108152157440, 284786463933696, 283686952306176, 567365264082688, 0, 4294967296, 1099511627776, 1103806595328, 281474976710656, 281479271743488, 282574488338688, 282578783371776, 1099511627776, 1103823372288, 2199023321088, 2203335065856, 282574488338688, 282578800148736, 283674000032256, 283678311842560, 4294967296, 12884901888, 1103823372288, 1112413307136, 281479271743488, 281487861743616, 282578800148736, 282587390149120, 1103806595328, 1112413307136, 2203335065856, 2211941777920, 282578783371776, 282587390149120, 283678311842560, 283686918620160, 16777216, 1103823372288, 1103823372288, 2207629967616, 281475010265088, 282578816925696, 282578816860416, 283682623521280, 1099528470528, 2203351842816, 2203335131136, 3307158503680, 282574521958656, 283678345396480, 283678328619520, 284782152057600, 4311744768, 1112413307136, 1108135117056, 2216236679680, 281479305298176, 282587406926080, 282583128670720, 283691230298880, 1103823438336, 2211941777920, 2207646876160, 3315765216000, 282578816992000, 283686935397120, 283682640430080, 284790758835456, 65536, 281479271743488, 2199023321088, 283678294999296, 281479271743488, 562958543486976, 283678294999296, 565157566743040, 1099528470528, 282578816925696, 3298551791616, 284777840247040, 282578800148736, 564058088669440, 284777823470080, 566257111991040, 4295098368, 281487861743616, 2203335131136, 283686901776640, 281483566841856, 562967133552640, 283682606874880, 565166173585920, 1103823503616, 282587406926080, 3302863601920, 284786447024640, 282583095247360, 564066678735360, 284782135345920, 566265718834176, 16843008, 282578800148736, 2203335065856, 284782118371840, 281479305298176, 564058088669440, 283682623521280, 566261406892800, 1099545313536, 283678345396480, 3302863601920, 285881663685120, 282578833768960, 565157633917440, 284782152057600, 567360952206336, 4311876096, 282587390149120, 2207646876160, 284790725149440, 281483600396800, 564066678735360, 283686935397120, 566270013735936, 1103840346880, 283686935397120, 3307175412480, 285890270462976, 282583128867840, 565166223983616, 284786463933696, 567369559049728, 256, 1103806595328, 282574488338688, 283678294934016, 282574488338688, 283678294999296, 565148976677376, 566252783338240, 1103806595328, 2207629967616, 283678294999296, 284782118371840, 283678294934016, 284782118371840, 566252783338240, 567356606776320, 4311744768, 1112413307136, 282578816860416, 283686918423040, 282578800148736, 283686901776640, 565153305264640, 566261406892800, 1108118340096, 2216236679680, 283682623521280, 284790741861120, 283682606744320, 284790725149440, 566257111925760, 567365230331136, 16843008, 2203335065856, 282578800148736, 284782118371840, 282574521958656, 284777840247040, 565153305264640, 567356623553280, 1103823503616, 3307158503680, 283682606874880, 285885941875200, 283678328619520, 285881663685120, 566257111991040, 568460447056896, 4328587776, 2211941777920, 282583128670720, 284790741861120, 282578833768960, 284786447024640, 565157633852160, 567365247108096, 1108135248640, 3315765216000, 283686935397120, 285894565364736, 283682640430080, 285890270462976, 566261440578816, 568469070611968, 66048, 282578783371776, 283674000032256, 566252783338240, 282578783371776, 565157566743040, 566252783338240, 848831566709760, 1103823438336, 283682623521280, 284777823470080, 567356623553280, 283682606744320, 566261406892800, 567356606776320, 849935406925056, 4311876096, 282587390149120, 283678328619520, 566261406892800, 282583095247360, 565166173585920, 566257111991040, 848840190329856, 1108135248640, 283691230298880, 284782152057600, 567365247108096, 283686918620160, 566270013735936, 567360935429376, 849944030545408, 16909056, 283678311842560, 283678311842560, 567356606776320, 282578816992000, 566257111991040, 566257111925760, 849935406925056, 1103840346880, 284782152057600, 284782135345920, 568460447056896, 283682640430080, 567360952206336, 567360935429376, 851039247205888, 4328719360, 283686918620160, 283682640430080, 567365230331136, 282583128867840, 566265718834176, 566261440578816, 849944030545408, 1108152157440, 284790758835456, 284786463933696, 568469070611968, 283686952306176, 567369559049728, 567365264082688, 851047870826496, 0, 16777216, 4294967296, 4311744768, 1099511627776, 1099528470528, 1103806595328, 1103823438336, 281474976710656, 281475010265088, 281479271743488, 281479305298176, 282574488338688, 282574521958656, 282578783371776, 282578816992000, 1099511627776, 1103823372288, 1103823372288, 1108135117056, 2199023321088, 2203335131136, 2203335065856, 2207646876160, 282574488338688, 282578816860416, 282578800148736, 282583128670720, 283674000032256, 283678328619520, 283678311842560, 283682640430080, 4294967296, 1103823372288, 12884901888, 1112413307136, 1103823372288, 2203351842816, 1112413307136, 2211941777920, 281479271743488, 282578816925696, 281487861743616, 282587406926080, 282578800148736, 283678345396480, 282587390149120, 283686935397120, 1103806595328, 2207629967616, 1112413307136, 2216236679680, 2203335065856, 3307158503680, 2211941777920, 3315765216000, 282578783371776, 283682623521280, 282587390149120, 283691230298880, 283678311842560, 284782152057600, 283686918620160, 284790758835456, 16777216, 281475010265088, 1103823372288, 282578816860416, 1103823372288, 282578816925696, 2207629967616, 283682623521280, 281475010265088, 562950020530176, 282578816925696, 564053827191040, 282578816860416, 564053827191040, 283682623521280, 565157633852160, 1099528470528, 282578816925696, 2203351842816, 283682640298240, 2203335131136, 283682623651840, 3307158503680, 284786447024640, 282574521958656, 564053827191040, 283678345396480, 565157650629120, 283678328619520, 565157633917440, 284782152057600, 566261457355776, 4311744768, 282578816860416, 1112413307136, 283686918423040, 1108135117056, 283682640298240, 2216236679680, 284790741861120, 281479305298176, 564053827191040, 282587406926080, 565161928819200, 282583128670720, 565157650629120, 283691230298880, 566265752257536, 1103823438336, 283682623521280, 2211941777920, 284790741861120, 2207646876160, 284786447024640, 3315765216000, 285894565364736, 282578816992000, 565157633852160, 283686935397120, 566265752257536, 283682640430080, 566261457355776, 284790758835456, 567369575761408, 65536, 1099528470528, 281479271743488, 282578800148736, 2199023321088, 3298551791616, 283678294999296, 284777823470080, 281479271743488, 282578816925696, 562958543486976, 564058088669440, 283678294999296, 284777840247040, 565157566743040, 566257111991040, 1099528470528, 2203351842816, 282578816925696, 283682640298240, 3298551791616, 4402375229440, 284777840247040, 285881663685120, 282578800148736, 283682640298240, 564058088669440, 565161928819200, 284777823470080, 285881663685120, 566257111991040, 567360952206336, 4295098368, 2203335131136, 281487861743616, 283686901776640, 2203335131136, 4402375229440, 283686901776640, 285885941875200, 281483566841856, 283682623651840, 562967133552640, 565166190362880, 283682606874880, 285881663750400, 565166173585920, 567365230461696, 1103823503616, 3307158503680, 282587406926080, 284790741926400, 3302863601920, 5506198667520, 284786447024640, 286989782090496, 282583095247360, 284786447024640, 564066678735360, 566270030512896, 284782135345920, 286985487188736, 566265718834176, 568469070677248, 16843008, 282574521958656, 282578800148736, 565153305264640, 2203335065856, 284777840247040, 284782118371840, 567356623553280, 281479305298176, 564053827191040, 564058088669440, 846632610562560, 283682623521280, 566257145479680, 566261406892800, 848835928851456, 1099545313536, 283678345396480, 283678345396480, 566257145479680, 3302863601920, 285881663750400, 285881663685120, 568460463833856, 282578833768960, 565157650629120, 565157633917440, 847736450777856, 284782152057600, 567360968983296, 567360952206336, 849939769132288, 4311876096, 283678328619520, 282587390149120, 566261406892800, 2207646876160, 285881663685120, 284790725149440, 568464741958656, 281483600396800, 565157633917440, 564066678735360, 847740712256256, 283686935397120, 567360968983296, 566270013735936, 849944047322368, 1103840346880, 284782152057600, 283686935397120, 567365247108096, 3307175412480, 286985487188736, 285890270462976, 569568582239488, 282583128867840, 566261457355776, 565166223983616, 848844552471808, 284786463933696, 568464792487168, 567369559049728, 851047887603456, 256, 4311744768, 1103806595328, 1108118340096, 282574488338688, 282578800148736, 283678294934016, 283682606744320, 282574488338688, 282578816860416, 283678294999296, 283682623521280, 565148976677376, 565153305264640, 566252783338240, 566257111925760, 1103806595328, 1112413307136, 2207629967616, 2216236679680, 283678294999296, 283686901776640, 284782118371840, 284790725149440, 283678294934016, 283686918423040, 284782118371840, 284790741861120, 566252783338240, 566261406892800, 567356606776320, 567365230331136, 4311744768, 1108135117056, 1112413307136, 2216236679680, 282578816860416, 283682640298240, 283686918423040, 284790741861120, 282578800148736, 283682640298240, 283686901776640, 284790741926400, 565153305264640, 566257145479680, 566261406892800, 567365247108096, 1108118340096, 2216236679680, 2216236679680, 3324355019520, 283682623521280, 284790741926400, 284790741861120, 285898860266496, 283682606744320, 284790741861120, 284790725149440, 285898860266496, 566257111925760, 567365247108096, 567365230331136, 568473365513728, 16843008, 281479305298176, 2203335065856, 283682623521280, 282578800148736, 564058088669440, 284782118371840, 566261406892800, 282574521958656, 564053827191040, 284777840247040, 566257145479680, 565153305264640, 846632610562560, 567356623553280, 848835928851456, 1103823503616, 282587406926080, 3307158503680, 284790741926400, 283682606874880, 565166190362880, 285885941875200, 567369525363456, 283678328619520, 565161928819200, 285881663685120, 567365263885056, 566257111991040, 847740712256256, 568460447056896, 849944047322368, 4328587776, 282583128670720, 2211941777920, 284790741861120, 282583128670720, 565161928819200, 284790741861120, 567369542009856, 282578833768960, 565157650629120, 284786447024640, 567365263885056, 565157633852160, 847736450777856, 567365247108096, 849944064034048, 1108135248640, 283691230298880, 3315765216000, 285898860266496, 283686935397120, 566270030512896, 285894565364736, 568477660480768, 283682640430080, 566265752257536, 285890270462976, 568473382290688, 566261440578816, 848844552471808, 568469070611968, 851052182505216, 66048, 1103823438336, 282578783371776, 283682606744320, 283674000032256, 284777823470080, 566252783338240, 567356606776320, 282578783371776, 283682623521280, 565157566743040, 566261406892800, 566252783338240, 567356623553280, 848831566709760, 849935406925056, 1103823438336, 2211941777920, 283682623521280, 284790741861120, 284777823470080, 285885941875200, 567356623553280, 568464741958656, 283682606744320, 284790741861120, 566261406892800, 567369542009856, 567356606776320, 568464741958656, 849935406925056, 851043542107648, 4311876096, 2207646876160, 282587390149120, 284790725149440, 283678328619520, 285881663685120, 566261406892800, 568464741958656, 282583095247360, 284786447024640, 565166173585920, 567369525363456, 566257111991040, 568460463833856, 848840190329856, 851043542172928, 1108135248640, 3315765216000, 283691230298880, 285898860266496, 284782152057600, 286989782090496, 567365247108096, 569572877141248, 283686918620160, 285894565364736, 566270013735936, 568477660480768, 567360935429376, 569568582239488, 849944030545408, 852151677355776, 16909056, 282578816992000, 283678311842560, 566257111925760, 283678311842560, 566257111991040, 567356606776320, 849935406925056, 282578816992000, 565157633852160, 566257111991040, 848835928851456, 566257111925760, 848835928851456, 849935406925056, 1132514223851008, 1103840346880, 283686935397120, 284782152057600, 567365247108096, 284782135345920, 567365230461696, 568460447056896, 851043542172928, 283682640430080, 566265752257536, 567360952206336, 849944064034048, 567360935429376, 849944047322368, 851039247205888, 1133622359099136, 4328719360, 283682640430080, 283686918620160, 567365230331136, 283682640430080, 567360952206336, 567365230331136, 851043542107648, 282583128867840, 566261457355776, 566265718834176, 849944047322368, 566261440578816, 849939769132288, 849944030545408, 1133622359099136, 1108152157440, 284790758835456, 284790758835456, 568473365513728, 284786463933696, 568469070677248, 568469070611968, 852151677355776, 283686952306176, 567369575761408, 567369559049728, 851052182505216, 567365264082688, 851047887603456, 851047870826496, 1134730494347520, 0, 65536, 16777216, 16843008, 4294967296, 4295098368, 4311744768, 4311876096, 1099511627776, 1099528470528, 1099528470528, 1099545313536, 1103806595328, 1103823503616, 1103823438336, 1103840346880, 281474976710656, 281479271743488, 281475010265088, 281479305298176, 281479271743488, 281483566841856, 281479305298176, 281483600396800, 282574488338688, 282578800148736, 282574521958656, 282578833768960, 282578783371776, 282583095247360, 282578816992000, 282583128867840, 1099511627776, 2199023321088, 1103823372288, 2203335065856, 1103823372288, 2203335131136, 1108135117056, 2207646876160, 2199023321088, 3298551791616, 2203335131136, 3302863601920, 2203335065856, 3302863601920, 2207646876160, 3307175412480, 282574488338688, 283678294999296, 282578816860416, 283682623521280, 282578800148736, 283682606874880, 282583128670720, 283686935397120, 283674000032256, 284777823470080, 283678328619520, 284782152057600, 283678311842560, 284782135345920, 283682640430080, 284786463933696, 4294967296, 281479271743488, 1103823372288, 282578800148736, 12884901888, 281487861743616, 1112413307136, 282587390149120, 1103823372288, 282578816925696, 2203351842816, 283678345396480, 1112413307136, 282587406926080, 2211941777920, 283686935397120, 281479271743488, 562958543486976, 282578816925696, 564058088669440, 281487861743616, 562967133552640, 282587406926080, 564066678735360, 282578800148736, 564058088669440, 283678345396480, 565157633917440, 282587390149120, 564066678735360, 283686935397120, 565166223983616, 1103806595328, 283678294999296, 2207629967616, 284782118371840, 1112413307136, 283686901776640, 2216236679680, 284790725149440, 2203335065856, 284777840247040, 3307158503680, 285881663685120, 2211941777920, 284786447024640, 3315765216000, 285890270462976, 282578783371776, 565157566743040, 283682623521280, 566261406892800, 282587390149120, 565166173585920, 283691230298880, 566270013735936, 283678311842560, 566257111991040, 284782152057600, 567360952206336, 283686918620160, 566265718834176, 284790758835456, 567369559049728, 16777216, 1099528470528, 281475010265088, 282574521958656, 1103823372288, 2203335131136, 282578816860416, 283678328619520, 1103823372288, 2203351842816, 282578816925696, 283678345396480, 2207629967616, 3307158503680, 283682623521280, 284782152057600, 281475010265088, 282578816925696, 562950020530176, 564053827191040, 282578816925696, 283682623651840, 564053827191040, 565157633917440, 282578816860416, 283682640298240, 564053827191040, 565157650629120, 283682623521280, 284786447024640, 565157633852160, 566261457355776, 1099528470528, 3298551791616, 282578816925696, 284777840247040, 2203351842816, 4402375229440, 283682640298240, 285881663685120, 2203335131136, 4402375229440, 283682623651840, 285881663750400, 3307158503680, 5506198667520, 284786447024640, 286985487188736, 282574521958656, 284777840247040, 564053827191040, 566257145479680, 283678345396480, 285881663750400, 565157650629120, 567360968983296, 283678328619520, 285881663685120, 565157633917440, 567360968983296, 284782152057600, 286985487188736, 566261457355776, 568464792487168, 4311744768, 282578800148736, 282578816860416, 565153305264640, 1112413307136, 283686901776640, 283686918423040, 566261406892800, 1108135117056, 283682640298240, 283682640298240, 566257145479680, 2216236679680, 284790741926400, 284790741861120, 567365247108096, 281479305298176, 564058088669440, 564053827191040, 846632610562560, 282587406926080, 565166190362880, 565161928819200, 847740712256256, 282583128670720, 565161928819200, 565157650629120, 847736450777856, 283691230298880, 566270030512896, 566265752257536, 848844552471808, 1103823438336, 284777823470080, 283682623521280, 567356623553280, 2211941777920, 285885941875200, 284790741861120, 568464741958656, 2207646876160, 285881663685120, 284786447024640, 568460463833856, 3315765216000, 286989782090496, 285894565364736, 569568582239488, 282578816992000, 566257111991040, 565157633852160, 848835928851456, 283686935397120, 567365230461696, 566265752257536, 849944047322368, 283682640430080, 567360952206336, 566261457355776, 849939769132288, 284790758835456, 568469070677248, 567369575761408, 851047887603456, 65536, 4295098368, 1099528470528, 1103823503616, 281479271743488, 281483566841856, 282578800148736, 282583095247360, 2199023321088, 2203335131136, 3298551791616, 3302863601920, 283678294999296, 283682606874880, 284777823470080, 284782135345920, 281479271743488, 281487861743616, 282578816925696, 282587406926080, 562958543486976, 562967133552640, 564058088669440, 564066678735360, 283678294999296, 283686901776640, 284777840247040, 284786447024640, 565157566743040, 565166173585920, 566257111991040, 566265718834176, 1099528470528, 2203335131136, 2203351842816, 3307158503680, 282578816925696, 283682623651840, 283682640298240, 284786447024640, 3298551791616, 4402375229440, 4402375229440, 5506198667520, 284777840247040, 285881663750400, 285881663685120, 286985487188736, 282578800148736, 283686901776640, 283682640298240, 284790741926400, 564058088669440, 565166190362880, 565161928819200, 566270030512896, 284777823470080, 285885941875200, 285881663685120, 286989782090496, 566257111991040, 567365230461696, 567360952206336, 568469070677248, 4295098368, 281483566841856, 2203335131136, 283682606874880, 281487861743616, 562967133552640, 283686901776640, 565166173585920, 2203335131136, 283682623651840, 4402375229440, 285881663750400, 283686901776640, 565166190362880, 285885941875200, 567365230461696, 281483566841856, 562967133552640, 283682623651840, 565166190362880, 562967133552640, 844450700328960, 565166190362880, 846649757139456, 283682606874880, 565166190362880, 285881663750400, 567365247238656, 565166173585920, 846649757139456, 567365230461696, 848848814015488, 1103823503616, 283682606874880, 3307158503680, 285885941875200, 282587406926080, 565166190362880, 284790741926400, 567369525363456, 3302863601920, 285881663750400, 5506198667520, 288084998816256, 284786447024640, 567365247238656, 286989782090496, 569568582304768, 282583095247360, 565166173585920, 284786447024640, 567369525363456, 564066678735360, 846649757139456, 566270030512896, 848853108917248, 284782135345920, 567365230461696, 286985487188736, 569568582304768, 566265718834176, 848848814015488, 568469070677248, 851052165858816, 16843008, 1103823503616, 282574521958656, 283678328619520, 282578800148736, 283682606874880, 565153305264640, 566257111991040, 2203335065856, 3307158503680, 284777840247040, 285881663685120, 284782118371840, 285885941875200, 567356623553280, 568460447056896, 281479305298176, 282587406926080, 564053827191040, 565161928819200, 564058088669440, 565166190362880, 846632610562560, 847740712256256, 283682623521280, 284790741926400, 566257145479680, 567365263885056, 566261406892800, 567369525363456, 848835928851456, 849944047322368, 1099545313536, 3302863601920, 283678345396480, 285881663685120, 283678345396480, 285881663750400, 566257145479680, 568460463833856, 3302863601920, 5506198667520, 285881663750400, 288084998816256, 285881663685120, 288084998816256, 568460463833856, 570663798965248, 282578833768960, 284786447024640, 565157650629120, 567365263885056, 565157633917440, 567365247238656, 847736450777856, 849944064099328, 284782152057600, 286989782090496, 567360968983296, 569568599016448, 567360952206336, 569568582304768, 849939769132288, 852147399230976, 4311876096, 282583095247360, 283678328619520, 566257111991040, 282587390149120, 565166173585920, 566261406892800, 848840190329856, 2207646876160, 284786447024640, 285881663685120, 568460463833856, 284790725149440, 567369525363456, 568464741958656, 851043542172928, 281483600396800, 564066678735360, 565157633917440, 847740712256256, 564066678735360, 846649757139456, 847740712256256, 1130323790660608, 283686935397120, 566270030512896, 567360968983296, 849944064099328, 566270013735936, 848853108917248, 849944047322368, 1132527142503936, 1103840346880, 284782135345920, 284782152057600, 568460447056896, 283686935397120, 567365230461696, 567365247108096, 851043542172928, 3307175412480, 286985487188736, 286985487188736, 570663798965248, 285890270462976, 569568582304768, 569568582239488, 853246894081536, 282583128867840, 566265718834176, 566261457355776, 849944047322368, 565166223983616, 848848814015488, 848844552471808, 1132527142503936, 284786463933696, 568469070677248, 568464792487168, 852147399230976, 567369559049728, 851052165858816, 851047887603456, 1134730494412800, 256, 16843008, 4311744768, 4328587776, 1103806595328, 1103823503616, 1108118340096, 1108135248640, 282574488338688, 282574521958656, 282578800148736, 282578833768960, 283678294934016, 283678328619520, 283682606744320, 283682640430080, 282574488338688, 282578800148736, 282578816860416, 282583128670720, 283678294999296, 283682606874880, 283682623521280, 283686935397120, 565148976677376, 565153305264640, 565153305264640, 565157633852160, 566252783338240, 566257111991040, 566257111925760, 566261440578816, 1103806595328, 2203335065856, 1112413307136, 2211941777920, 2207629967616, 3307158503680, 2216236679680, 3315765216000, 283678294999296, 284777840247040, 283686901776640, 284786447024640, 284782118371840, 285881663685120, 284790725149440, 285890270462976, 283678294934016, 284782118371840, 283686918423040, 284790741861120, 284782118371840, 285885941875200, 284790741861120, 285894565364736, 566252783338240, 567356623553280, 566261406892800, 567365247108096, 567356606776320, 568460447056896, 567365230331136, 568469070611968, 4311744768, 281479305298176, 1108135117056, 282583128670720, 1112413307136, 282587406926080, 2216236679680, 283691230298880, 282578816860416, 564053827191040, 283682640298240, 565157650629120, 283686918423040, 565161928819200, 284790741861120, 566265752257536, 282578800148736, 564058088669440, 283682640298240, 565161928819200, 283686901776640, 565166190362880, 284790741926400, 566270030512896, 565153305264640, 846632610562560, 566257145479680, 847736450777856, 566261406892800, 847740712256256, 567365247108096, 848844552471808, 1108118340096, 283682623521280, 2216236679680, 284790741861120, 2216236679680, 284790741926400, 3324355019520, 285898860266496, 283682623521280, 566257145479680, 284790741926400, 567365263885056, 284790741861120, 567365263885056, 285898860266496, 568473382290688, 283682606744320, 566261406892800, 284790741861120, 567369542009856, 284790725149440, 567369525363456, 285898860266496, 568477660480768, 566257111925760, 848835928851456, 567365247108096, 849944064034048, 567365230331136, 849944047322368, 568473365513728, 851052182505216, 16843008, 1099545313536, 281479305298176, 282578833768960, 2203335065856, 3302863601920, 283682623521280, 284782152057600, 282578800148736, 283678345396480, 564058088669440, 565157633917440, 284782118371840, 285881663685120, 566261406892800, 567360952206336, 282574521958656, 283678345396480, 564053827191040, 565157650629120, 284777840247040, 285881663750400, 566257145479680, 567360968983296, 565153305264640, 566257145479680, 846632610562560, 847736450777856, 567356623553280, 568460463833856, 848835928851456, 849939769132288, 1103823503616, 3302863601920, 282587406926080, 284786447024640, 3307158503680, 5506198667520, 284790741926400, 286989782090496, 283682606874880, 285881663750400, 565166190362880, 567365247238656, 285885941875200, 288084998816256, 567369525363456, 569568582304768, 283678328619520, 285881663685120, 565161928819200, 567365263885056, 285881663685120, 288084998816256, 567365263885056, 569568599016448, 566257111991040, 568460463833856, 847740712256256, 849944064099328, 568460447056896, 570663798965248, 849944047322368, 852147399230976, 4328587776, 282578833768960, 282583128670720, 565157633852160, 2211941777920, 284786447024640, 284790741861120, 567365247108096, 282583128670720, 565157650629120, 565161928819200, 847736450777856, 284790741861120, 567365263885056, 567369542009856, 849944064034048, 282578833768960, 565157633917440, 565157650629120, 847736450777856, 284786447024640, 567365247238656, 567365263885056, 849944064099328, 565157633852160, 847736450777856, 847736450777856, 1130315267703808, 567365247108096, 849944064099328, 849944064034048, 1132522881025536, 1108135248640, 284782152057600, 283691230298880, 567365247108096, 3315765216000, 286989782090496, 285898860266496, 569572877141248, 283686935397120, 567360968983296, 566270030512896, 849944064099328, 285894565364736, 569568599016448, 568477660480768, 852151694132736, 283682640430080, 567360952206336, 566265752257536, 849944064034048, 285890270462976, 569568582304768, 568473382290688, 852151694132736, 566261440578816, 849939769132288, 848844552471808, 1132522881025536, 568469070611968, 852147399230976, 851052182505216, 1134730511124480, 66048, 4311876096, 1103823438336, 1108135248640, 282578783371776, 282583095247360, 283682606744320, 283686918620160, 283674000032256, 283678328619520, 284777823470080, 284782152057600, 566252783338240, 566257111991040, 567356606776320, 567360935429376, 282578783371776, 282587390149120, 283682623521280, 283691230298880, 565157566743040, 565166173585920, 566261406892800, 566270013735936, 566252783338240, 566261406892800, 567356623553280, 567365247108096, 848831566709760, 848840190329856, 849935406925056, 849944030545408, 1103823438336, 2207646876160, 2211941777920, 3315765216000, 283682623521280, 284786447024640, 284790741861120, 285894565364736, 284777823470080, 285881663685120, 285885941875200, 286989782090496, 567356623553280, 568460463833856, 568464741958656, 569568582239488, 283682606744320, 284790725149440, 284790741861120, 285898860266496, 566261406892800, 567369525363456, 567369542009856, 568477660480768, 567356606776320, 568464741958656, 568464741958656, 569572877141248, 849935406925056, 851043542172928, 851043542107648, 852151677355776, 4311876096, 281483600396800, 2207646876160, 283686935397120, 282587390149120, 564066678735360, 284790725149440, 566270013735936, 283678328619520, 565157633917440, 285881663685120, 567360968983296, 566261406892800, 847740712256256, 568464741958656, 849944047322368, 282583095247360, 564066678735360, 284786447024640, 566270030512896, 565166173585920, 846649757139456, 567369525363456, 848853108917248, 566257111991040, 847740712256256, 568460463833856, 849944064099328, 848840190329856, 1130323790660608, 851043542172928, 1132527142503936, 1108135248640, 283686935397120, 3315765216000, 285894565364736, 283691230298880, 566270030512896, 285898860266496, 568477660480768, 284782152057600, 567360968983296, 286989782090496, 569568599016448, 567365247108096, 849944064099328, 569572877141248, 852151694132736, 283686918620160, 566270013735936, 285894565364736, 568477660480768, 566270013735936, 848853108917248, 568477660480768, 851060755662336, 567360935429376, 849944047322368, 569568582239488, 852151694132736, 849944030545408, 1132527142503936, 852151677355776, 1134734789314560, 16909056, 1103840346880, 282578816992000, 283682640430080, 283678311842560, 284782135345920, 566257111925760, 567360935429376, 283678311842560, 284782152057600, 566257111991040, 567360952206336, 567356606776320, 568460447056896, 849935406925056, 851039247205888, 282578816992000, 283686935397120, 565157633852160, 566265752257536, 566257111991040, 567365230461696, 848835928851456, 849944047322368, 566257111925760, 567365247108096, 848835928851456, 849944064034048, 849935406925056, 851043542172928, 1132514223851008, 1133622359099136, 1103840346880, 3307175412480, 283686935397120, 285890270462976, 284782152057600, 286985487188736, 567365247108096, 569568582239488, 284782135345920, 286985487188736, 567365230461696, 569568582304768, 568460447056896, 570663798965248, 851043542172928, 853246894081536, 283682640430080, 285890270462976, 566265752257536, 568473382290688, 567360952206336, 569568582304768, 849944064034048, 852151694132736, 567360935429376, 569568582239488, 849944047322368, 852151694132736, 851039247205888, 853246894081536, 1133622359099136, 1135830005975040, 4328719360, 282583128867840, 283682640430080, 566261440578816, 283686918620160, 566265718834176, 567365230331136, 849944030545408, 283682640430080, 566261457355776, 567360952206336, 849939769132288, 567365230331136, 849944047322368, 851043542107648, 1133622359099136, 282583128867840, 565166223983616, 566261457355776, 848844552471808, 566265718834176, 848848814015488, 849944047322368, 1132527142503936, 566261440578816, 848844552471808, 849939769132288, 1132522881025536, 849944030545408, 1132527142503936, 1133622359099136, 1416205471057920, 1108152157440, 284786463933696, 284790758835456, 568469070611968, 284790758835456, 568469070677248, 568473365513728, 852151677355776, 284786463933696, 568464792487168, 568469070677248, 852147399230976, 568469070611968, 852147399230976, 852151677355776, 1135830005975040, 283686952306176, 567369559049728, 567369575761408, 851052182505216, 567369559049728, 851052165858816, 851052182505216, 1134734789314560, 567365264082688, 851047887603456, 851047887603456, 1134730511124480, 851047870826496, 1134730494412800, 1134730494347520, 1418413117934080, 0, 256, 65536, 66048, 16777216, 16843008, 16843008, 16909056, 4294967296, 4311744768, 4295098368, 4311876096, 4311744768, 4328587776, 4311876096, 4328719360, 1099511627776, 1103806595328, 1099528470528, 1103823438336, 1099528470528, 1103823503616, 1099545313536, 1103840346880, 1103806595328, 1108118340096, 1103823503616, 1108135248640, 1103823438336, 1108135248640, 1103840346880, 1108152157440, 281474976710656, 282574488338688, 281479271743488, 282578783371776, 281475010265088, 282574521958656, 281479305298176, 282578816992000, 281479271743488, 282578800148736, 281483566841856, 282583095247360, 281479305298176, 282578833768960, 281483600396800, 282583128867840, 282574488338688, 283678294934016, 282578800148736, 283682606744320, 282574521958656, 283678328619520, 282578833768960, 283682640430080, 282578783371776, 283682606744320, 282583095247360, 283686918620160, 282578816992000, 283682640430080, 282583128867840, 283686952306176, 1099511627776, 282574488338688, 2199023321088, 283674000032256, 1103823372288, 282578800148736, 2203335065856, 283678311842560, 1103823372288, 282578816860416, 2203335131136, 283678328619520, 1108135117056, 282583128670720, 2207646876160, 283682640430080, 2199023321088, 283678294999296, 3298551791616, 284777823470080, 2203335131136, 283682606874880, 3302863601920, 284782135345920, 2203335065856, 283682623521280, 3302863601920, 284782152057600, 2207646876160, 283686935397120, 3307175412480, 284786463933696, 282574488338688, 565148976677376, 283678294999296, 566252783338240, 282578816860416, 565153305264640, 283682623521280, 566257111925760, 282578800148736, 565153305264640, 283682606874880, 566257111991040, 282583128670720, 565157633852160, 283686935397120, 566261440578816, 283674000032256, 566252783338240, 284777823470080, 567356606776320, 283678328619520, 566257111991040, 284782152057600, 567360935429376, 283678311842560, 566257111925760, 284782135345920, 567360935429376, 283682640430080, 566261440578816, 284786463933696, 567365264082688, 4294967296, 1103806595328, 281479271743488, 282578783371776, 1103823372288, 2203335065856, 282578800148736, 283678311842560, 12884901888, 1112413307136, 281487861743616, 282587390149120, 1112413307136, 2211941777920, 282587390149120, 283686918620160, 1103823372288, 2207629967616, 282578816925696, 283682623521280, 2203351842816, 3307158503680, 283678345396480, 284782152057600, 1112413307136, 2216236679680, 282587406926080, 283691230298880, 2211941777920, 3315765216000, 283686935397120, 284790758835456, 281479271743488, 283678294999296, 562958543486976, 565157566743040, 282578816925696, 284777840247040, 564058088669440, 566257111991040, 281487861743616, 283686901776640, 562967133552640, 565166173585920, 282587406926080, 284786447024640, 564066678735360, 566265718834176, 282578800148736, 284782118371840, 564058088669440, 566261406892800, 283678345396480, 285881663685120, 565157633917440, 567360952206336, 282587390149120, 284790725149440, 564066678735360, 566270013735936, 283686935397120, 285890270462976, 565166223983616, 567369559049728, 1103806595328, 283678294934016, 283678294999296, 566252783338240, 2207629967616, 284782118371840, 284782118371840, 567356606776320, 1112413307136, 283686918423040, 283686901776640, 566261406892800, 2216236679680, 284790741861120, 284790725149440, 567365230331136, 2203335065856, 284782118371840, 284777840247040, 567356623553280, 3307158503680, 285885941875200, 285881663685120, 568460447056896, 2211941777920, 284790741861120, 284786447024640, 567365247108096, 3315765216000, 285894565364736, 285890270462976, 568469070611968, 282578783371776, 566252783338240, 565157566743040, 848831566709760, 283682623521280, 567356623553280, 566261406892800, 849935406925056, 282587390149120, 566261406892800, 565166173585920, 848840190329856, 283691230298880, 567365247108096, 566270013735936, 849944030545408, 283678311842560, 567356606776320, 566257111991040, 849935406925056, 284782152057600, 568460447056896, 567360952206336, 851039247205888, 283686918620160, 567365230331136, 566265718834176, 849944030545408, 284790758835456, 568469070611968, 567369559049728, 851047870826496, 16777216, 4311744768, 1099528470528, 1103823438336, 281475010265088, 281479305298176, 282574521958656, 282578816992000, 1103823372288, 1108135117056, 2203335131136, 2207646876160, 282578816860416, 282583128670720, 283678328619520, 283682640430080, 1103823372288, 1112413307136, 2203351842816, 2211941777920, 282578816925696, 282587406926080, 283678345396480, 283686935397120, 2207629967616, 2216236679680, 3307158503680, 3315765216000, 283682623521280, 283691230298880, 284782152057600, 284790758835456, 281475010265088, 282578816860416, 282578816925696, 283682623521280, 562950020530176, 564053827191040, 564053827191040, 565157633852160, 282578816925696, 283682640298240, 283682623651840, 284786447024640, 564053827191040, 565157650629120, 565157633917440, 566261457355776, 282578816860416, 283686918423040, 283682640298240, 284790741861120, 564053827191040, 565161928819200, 565157650629120, 566265752257536, 283682623521280, 284790741861120, 284786447024640, 285894565364736, 565157633852160, 566265752257536, 566261457355776, 567369575761408, 1099528470528, 282578800148736, 3298551791616, 284777823470080, 282578816925696, 564058088669440, 284777840247040, 566257111991040, 2203351842816, 283682640298240, 4402375229440, 285881663685120, 283682640298240, 565161928819200, 285881663685120, 567360952206336, 2203335131136, 283686901776640, 4402375229440, 285885941875200, 283682623651840, 565166190362880, 285881663750400, 567365230461696, 3307158503680, 284790741926400, 5506198667520, 286989782090496, 284786447024640, 566270030512896, 286985487188736, 568469070677248, 282574521958656, 565153305264640, 284777840247040, 567356623553280, 564053827191040, 846632610562560, 566257145479680, 848835928851456, 283678345396480, 566257145479680, 285881663750400, 568460463833856, 565157650629120, 847736450777856, 567360968983296, 849939769132288, 283678328619520, 566261406892800, 285881663685120, 568464741958656, 565157633917440, 847740712256256, 567360968983296, 849944047322368, 284782152057600, 567365247108096, 286985487188736, 569568582239488, 566261457355776, 848844552471808, 568464792487168, 851047887603456, 4311744768, 1108118340096, 282578800148736, 283682606744320, 282578816860416, 283682623521280, 565153305264640, 566257111925760, 1112413307136, 2216236679680, 283686901776640, 284790725149440, 283686918423040, 284790741861120, 566261406892800, 567365230331136, 1108135117056, 2216236679680, 283682640298240, 284790741861120, 283682640298240, 284790741926400, 566257145479680, 567365247108096, 2216236679680, 3324355019520, 284790741926400, 285898860266496, 284790741861120, 285898860266496, 567365247108096, 568473365513728, 281479305298176, 283682623521280, 564058088669440, 566261406892800, 564053827191040, 566257145479680, 846632610562560, 848835928851456, 282587406926080, 284790741926400, 565166190362880, 567369525363456, 565161928819200, 567365263885056, 847740712256256, 849944047322368, 282583128670720, 284790741861120, 565161928819200, 567369542009856, 565157650629120, 567365263885056, 847736450777856, 849944064034048, 283691230298880, 285898860266496, 566270030512896, 568477660480768, 566265752257536, 568473382290688, 848844552471808, 851052182505216, 1103823438336, 283682606744320, 284777823470080, 567356606776320, 283682623521280, 566261406892800, 567356623553280, 849935406925056, 2211941777920, 284790741861120, 285885941875200, 568464741958656, 284790741861120, 567369542009856, 568464741958656, 851043542107648, 2207646876160, 284790725149440, 285881663685120, 568464741958656, 284786447024640, 567369525363456, 568460463833856, 851043542172928, 3315765216000, 285898860266496, 286989782090496, 569572877141248, 285894565364736, 568477660480768, 569568582239488, 852151677355776, 282578816992000, 566257111925760, 566257111991040, 849935406925056, 565157633852160, 848835928851456, 848835928851456, 1132514223851008, 283686935397120, 567365247108096, 567365230461696, 851043542172928, 566265752257536, 849944064034048, 849944047322368, 1133622359099136, 283682640430080, 567365230331136, 567360952206336, 851043542107648, 566261457355776, 849944047322368, 849939769132288, 1133622359099136, 284790758835456, 568473365513728, 568469070677248, 852151677355776, 567369575761408, 851052182505216, 851047887603456, 1134730494347520, 65536, 16843008, 4295098368, 4311876096, 1099528470528, 1099545313536, 1103823503616, 1103840346880, 281479271743488, 281479305298176, 281483566841856, 281483600396800, 282578800148736, 282578833768960, 282583095247360, 282583128867840, 2199023321088, 2203335065856, 2203335131136, 2207646876160, 3298551791616, 3302863601920, 3302863601920, 3307175412480, 283678294999296, 283682623521280, 283682606874880, 283686935397120, 284777823470080, 284782152057600, 284782135345920, 284786463933696, 281479271743488, 282578800148736, 281487861743616, 282587390149120, 282578816925696, 283678345396480, 282587406926080, 283686935397120, 562958543486976, 564058088669440, 562967133552640, 564066678735360, 564058088669440, 565157633917440, 564066678735360, 565166223983616, 283678294999296, 284782118371840, 283686901776640, 284790725149440, 284777840247040, 285881663685120, 284786447024640, 285890270462976, 565157566743040, 566261406892800, 565166173585920, 566270013735936, 566257111991040, 567360952206336, 566265718834176, 567369559049728, 1099528470528, 282574521958656, 2203335131136, 283678328619520, 2203351842816, 283678345396480, 3307158503680, 284782152057600, 282578816925696, 564053827191040, 283682623651840, 565157633917440, 283682640298240, 565157650629120, 284786447024640, 566261457355776, 3298551791616, 284777840247040, 4402375229440, 285881663685120, 4402375229440, 285881663750400, 5506198667520, 286985487188736, 284777840247040, 566257145479680, 285881663750400, 567360968983296, 285881663685120, 567360968983296, 286985487188736, 568464792487168, 282578800148736, 565153305264640, 283686901776640, 566261406892800, 283682640298240, 566257145479680, 284790741926400, 567365247108096, 564058088669440, 846632610562560, 565166190362880, 847740712256256, 565161928819200, 847736450777856, 566270030512896, 848844552471808, 284777823470080, 567356623553280, 285885941875200, 568464741958656, 285881663685120, 568460463833856, 286989782090496, 569568582239488, 566257111991040, 848835928851456, 567365230461696, 849944047322368, 567360952206336, 849939769132288, 568469070677248, 851047887603456, 4295098368, 1103823503616, 281483566841856, 282583095247360, 2203335131136, 3302863601920, 283682606874880, 284782135345920, 281487861743616, 282587406926080, 562967133552640, 564066678735360, 283686901776640, 284786447024640, 565166173585920, 566265718834176, 2203335131136, 3307158503680, 283682623651840, 284786447024640, 4402375229440, 5506198667520, 285881663750400, 286985487188736, 283686901776640, 284790741926400, 565166190362880, 566270030512896, 285885941875200, 286989782090496, 567365230461696, 568469070677248, 281483566841856, 283682606874880, 562967133552640, 565166173585920, 283682623651840, 285881663750400, 565166190362880, 567365230461696, 562967133552640, 565166190362880, 844450700328960, 846649757139456, 565166190362880, 567365247238656, 846649757139456, 848848814015488, 283682606874880, 285885941875200, 565166190362880, 567369525363456, 285881663750400, 288084998816256, 567365247238656, 569568582304768, 565166173585920, 567369525363456, 846649757139456, 848853108917248, 567365230461696, 569568582304768, 848848814015488, 851052165858816, 1103823503616, 283678328619520, 283682606874880, 566257111991040, 3307158503680, 285881663685120, 285885941875200, 568460447056896, 282587406926080, 565161928819200, 565166190362880, 847740712256256, 284790741926400, 567365263885056, 567369525363456, 849944047322368, 3302863601920, 285881663685120, 285881663750400, 568460463833856, 5506198667520, 288084998816256, 288084998816256, 570663798965248, 284786447024640, 567365263885056, 567365247238656, 849944064099328, 286989782090496, 569568599016448, 569568582304768, 852147399230976, 282583095247360, 566257111991040, 565166173585920, 848840190329856, 284786447024640, 568460463833856, 567369525363456, 851043542172928, 564066678735360, 847740712256256, 846649757139456, 1130323790660608, 566270030512896, 849944064099328, 848853108917248, 1132527142503936, 284782135345920, 568460447056896, 567365230461696, 851043542172928, 286985487188736, 570663798965248, 569568582304768, 853246894081536, 566265718834176, 849944047322368, 848848814015488, 1132527142503936, 568469070677248, 852147399230976, 851052165858816, 1134730494412800, 16843008, 4328587776, 1103823503616, 1108135248640, 282574521958656, 282578833768960, 283678328619520, 283682640430080, 282578800148736, 282583128670720, 283682606874880, 283686935397120, 565153305264640, 565157633852160, 566257111991040, 566261440578816, 2203335065856, 2211941777920, 3307158503680, 3315765216000, 284777840247040, 284786447024640, 285881663685120, 285890270462976, 284782118371840, 284790741861120, 285885941875200, 285894565364736, 567356623553280, 567365247108096, 568460447056896, 568469070611968, 281479305298176, 282583128670720, 282587406926080, 283691230298880, 564053827191040, 565157650629120, 565161928819200, 566265752257536, 564058088669440, 565161928819200, 565166190362880, 566270030512896, 846632610562560, 847736450777856, 847740712256256, 848844552471808, 283682623521280, 284790741861120, 284790741926400, 285898860266496, 566257145479680, 567365263885056, 567365263885056, 568473382290688, 566261406892800, 567369542009856, 567369525363456, 568477660480768, 848835928851456, 849944064034048, 849944047322368, 851052182505216, 1099545313536, 282578833768960, 3302863601920, 284782152057600, 283678345396480, 565157633917440, 285881663685120, 567360952206336, 283678345396480, 565157650629120, 285881663750400, 567360968983296, 566257145479680, 847736450777856, 568460463833856, 849939769132288, 3302863601920, 284786447024640, 5506198667520, 286989782090496, 285881663750400, 567365247238656, 288084998816256, 569568582304768, 285881663685120, 567365263885056, 288084998816256, 569568599016448, 568460463833856, 849944064099328, 570663798965248, 852147399230976, 282578833768960, 565157633852160, 284786447024640, 567365247108096, 565157650629120, 847736450777856, 567365263885056, 849944064034048, 565157633917440, 847736450777856, 567365247238656, 849944064099328, 847736450777856, 1130315267703808, 849944064099328, 1132522881025536, 284782152057600, 567365247108096, 286989782090496, 569572877141248, 567360968983296, 849944064099328, 569568599016448, 852151694132736, 567360952206336, 849944064034048, 569568582304768, 852151694132736, 849939769132288, 1132522881025536, 852147399230976, 1134730511124480, 4311876096, 1108135248640, 282583095247360, 283686918620160, 283678328619520, 284782152057600, 566257111991040, 567360935429376, 282587390149120, 283691230298880, 565166173585920, 566270013735936, 566261406892800, 567365247108096, 848840190329856, 849944030545408, 2207646876160, 3315765216000, 284786447024640, 285894565364736, 285881663685120, 286989782090496, 568460463833856, 569568582239488, 284790725149440, 285898860266496, 567369525363456, 568477660480768, 568464741958656, 569572877141248, 851043542172928, 852151677355776, 281483600396800, 283686935397120, 564066678735360, 566270013735936, 565157633917440, 567360968983296, 847740712256256, 849944047322368, 564066678735360, 566270030512896, 846649757139456, 848853108917248, 847740712256256, 849944064099328, 1130323790660608, 1132527142503936, 283686935397120, 285894565364736, 566270030512896, 568477660480768, 567360968983296, 569568599016448, 849944064099328, 852151694132736, 566270013735936, 568477660480768, 848853108917248, 851060755662336, 849944047322368, 852151694132736, 1132527142503936, 1134734789314560, 1103840346880, 283682640430080, 284782135345920, 567360935429376, 284782152057600, 567360952206336, 568460447056896, 851039247205888, 283686935397120, 566265752257536, 567365230461696, 849944047322368, 567365247108096, 849944064034048, 851043542172928, 1133622359099136, 3307175412480, 285890270462976, 286985487188736, 569568582239488, 286985487188736, 569568582304768, 570663798965248, 853246894081536, 285890270462976, 568473382290688, 569568582304768, 852151694132736, 569568582239488, 852151694132736, 853246894081536, 1135830005975040, 282583128867840, 566261440578816, 566265718834176, 849944030545408, 566261457355776, 849939769132288, 849944047322368, 1133622359099136, 565166223983616, 848844552471808, 848848814015488, 1132527142503936, 848844552471808, 1132522881025536, 1132527142503936, 1416205471057920, 284786463933696, 568469070611968, 568469070677248, 852151677355776, 568464792487168, 852147399230976, 852147399230976, 1135830005975040, 567369559049728, 851052182505216, 851052165858816, 1134734789314560, 851047887603456, 1134730511124480, 1134730494412800, 1418413117934080, 256, 66048, 16843008, 16909056, 4311744768, 4311876096, 4328587776, 4328719360, 1103806595328, 1103823438336, 1103823503616, 1103840346880, 1108118340096, 1108135248640, 1108135248640, 1108152157440, 282574488338688, 282578783371776, 282574521958656, 282578816992000, 282578800148736, 282583095247360, 282578833768960, 282583128867840, 283678294934016, 283682606744320, 283678328619520, 283682640430080, 283682606744320, 283686918620160, 283682640430080, 283686952306176, 282574488338688, 283674000032256, 282578800148736, 283678311842560, 282578816860416, 283678328619520, 282583128670720, 283682640430080, 283678294999296, 284777823470080, 283682606874880, 284782135345920, 283682623521280, 284782152057600, 283686935397120, 284786463933696, 565148976677376, 566252783338240, 565153305264640, 566257111925760, 565153305264640, 566257111991040, 565157633852160, 566261440578816, 566252783338240, 567356606776320, 566257111991040, 567360935429376, 566257111925760, 567360935429376, 566261440578816, 567365264082688, 1103806595328, 282578783371776, 2203335065856, 283678311842560, 1112413307136, 282587390149120, 2211941777920, 283686918620160, 2207629967616, 283682623521280, 3307158503680, 284782152057600, 2216236679680, 283691230298880, 3315765216000, 284790758835456, 283678294999296, 565157566743040, 284777840247040, 566257111991040, 283686901776640, 565166173585920, 284786447024640, 566265718834176, 284782118371840, 566261406892800, 285881663685120, 567360952206336, 284790725149440, 566270013735936, 285890270462976, 567369559049728, 283678294934016, 566252783338240, 284782118371840, 567356606776320, 283686918423040, 566261406892800, 284790741861120, 567365230331136, 284782118371840, 567356623553280, 285885941875200, 568460447056896, 284790741861120, 567365247108096, 285894565364736, 568469070611968, 566252783338240, 848831566709760, 567356623553280, 849935406925056, 566261406892800, 848840190329856, 567365247108096, 849944030545408, 567356606776320, 849935406925056, 568460447056896, 851039247205888, 567365230331136, 849944030545408, 568469070611968, 851047870826496, 4311744768, 1103823438336, 281479305298176, 282578816992000, 1108135117056, 2207646876160, 282583128670720, 283682640430080, 1112413307136, 2211941777920, 282587406926080, 283686935397120, 2216236679680, 3315765216000, 283691230298880, 284790758835456, 282578816860416, 283682623521280, 564053827191040, 565157633852160, 283682640298240, 284786447024640, 565157650629120, 566261457355776, 283686918423040, 284790741861120, 565161928819200, 566265752257536, 284790741861120, 285894565364736, 566265752257536, 567369575761408, 282578800148736, 284777823470080, 564058088669440, 566257111991040, 283682640298240, 285881663685120, 565161928819200, 567360952206336, 283686901776640, 285885941875200, 565166190362880, 567365230461696, 284790741926400, 286989782090496, 566270030512896, 568469070677248, 565153305264640, 567356623553280, 846632610562560, 848835928851456, 566257145479680, 568460463833856, 847736450777856, 849939769132288, 566261406892800, 568464741958656, 847740712256256, 849944047322368, 567365247108096, 569568582239488, 848844552471808, 851047887603456, 1108118340096, 283682606744320, 283682623521280, 566257111925760, 2216236679680, 284790725149440, 284790741861120, 567365230331136, 2216236679680, 284790741861120, 284790741926400, 567365247108096, 3324355019520, 285898860266496, 285898860266496, 568473365513728, 283682623521280, 566261406892800, 566257145479680, 848835928851456, 284790741926400, 567369525363456, 567365263885056, 849944047322368, 284790741861120, 567369542009856, 567365263885056, 849944064034048, 285898860266496, 568477660480768, 568473382290688, 851052182505216, 283682606744320, 567356606776320, 566261406892800, 849935406925056, 284790741861120, 568464741958656, 567369542009856, 851043542107648, 284790725149440, 568464741958656, 567369525363456, 851043542172928, 285898860266496, 569572877141248, 568477660480768, 852151677355776, 566257111925760, 849935406925056, 848835928851456, 1132514223851008, 567365247108096, 851043542172928, 849944064034048, 1133622359099136, 567365230331136, 851043542107648, 849944047322368, 1133622359099136, 568473365513728, 852151677355776, 851052182505216, 1134730494347520, 16843008, 4311876096, 1099545313536, 1103840346880, 281479305298176, 281483600396800, 282578833768960, 282583128867840, 2203335065856, 2207646876160, 3302863601920, 3307175412480, 283682623521280, 283686935397120, 284782152057600, 284786463933696, 282578800148736, 282587390149120, 283678345396480, 283686935397120, 564058088669440, 564066678735360, 565157633917440, 565166223983616, 284782118371840, 284790725149440, 285881663685120, 285890270462976, 566261406892800, 566270013735936, 567360952206336, 567369559049728, 282574521958656, 283678328619520, 283678345396480, 284782152057600, 564053827191040, 565157633917440, 565157650629120, 566261457355776, 284777840247040, 285881663685120, 285881663750400, 286985487188736, 566257145479680, 567360968983296, 567360968983296, 568464792487168, 565153305264640, 566261406892800, 566257145479680, 567365247108096, 846632610562560, 847740712256256, 847736450777856, 848844552471808, 567356623553280, 568464741958656, 568460463833856, 569568582239488, 848835928851456, 849944047322368, 849939769132288, 851047887603456, 1103823503616, 282583095247360, 3302863601920, 284782135345920, 282587406926080, 564066678735360, 284786447024640, 566265718834176, 3307158503680, 284786447024640, 5506198667520, 286985487188736, 284790741926400, 566270030512896, 286989782090496, 568469070677248, 283682606874880, 565166173585920, 285881663750400, 567365230461696, 565166190362880, 846649757139456, 567365247238656, 848848814015488, 285885941875200, 567369525363456, 288084998816256, 569568582304768, 567369525363456, 848853108917248, 569568582304768, 851052165858816, 283678328619520, 566257111991040, 285881663685120, 568460447056896, 565161928819200, 847740712256256, 567365263885056, 849944047322368, 285881663685120, 568460463833856, 288084998816256, 570663798965248, 567365263885056, 849944064099328, 569568599016448, 852147399230976, 566257111991040, 848840190329856, 568460463833856, 851043542172928, 847740712256256, 1130323790660608, 849944064099328, 1132527142503936, 568460447056896, 851043542172928, 570663798965248, 853246894081536, 849944047322368, 1132527142503936, 852147399230976, 1134730494412800, 4328587776, 1108135248640, 282578833768960, 283682640430080, 282583128670720, 283686935397120, 565157633852160, 566261440578816, 2211941777920, 3315765216000, 284786447024640, 285890270462976, 284790741861120, 285894565364736, 567365247108096, 568469070611968, 282583128670720, 283691230298880, 565157650629120, 566265752257536, 565161928819200, 566270030512896, 847736450777856, 848844552471808, 284790741861120, 285898860266496, 567365263885056, 568473382290688, 567369542009856, 568477660480768, 849944064034048, 851052182505216, 282578833768960, 284782152057600, 565157633917440, 567360952206336, 565157650629120, 567360968983296, 847736450777856, 849939769132288, 284786447024640, 286989782090496, 567365247238656, 569568582304768, 567365263885056, 569568599016448, 849944064099328, 852147399230976, 565157633852160, 567365247108096, 847736450777856, 849944064034048, 847736450777856, 849944064099328, 1130315267703808, 1132522881025536, 567365247108096, 569572877141248, 849944064099328, 852151694132736, 849944064034048, 852151694132736, 1132522881025536, 1134730511124480, 1108135248640, 283686918620160, 284782152057600, 567360935429376, 283691230298880, 566270013735936, 567365247108096, 849944030545408, 3315765216000, 285894565364736, 286989782090496, 569568582239488, 285898860266496, 568477660480768, 569572877141248, 852151677355776, 283686935397120, 566270013735936, 567360968983296, 849944047322368, 566270030512896, 848853108917248, 849944064099328, 1132527142503936, 285894565364736, 568477660480768, 569568599016448, 852151694132736, 568477660480768, 851060755662336, 852151694132736, 1134734789314560, 283682640430080, 567360935429376, 567360952206336, 851039247205888, 566265752257536, 849944047322368, 849944064034048, 1133622359099136, 285890270462976, 569568582239488, 569568582304768, 853246894081536, 568473382290688, 852151694132736, 852151694132736, 1135830005975040, 566261440578816, 849944030545408, 849939769132288, 1133622359099136, 848844552471808, 1132527142503936, 1132522881025536, 1416205471057920, 568469070611968, 852151677355776, 852147399230976, 1135830005975040, 851052182505216, 1134734789314560, 1134730511124480, 1418413117934080, 66048, 16909056, 4311876096, 4328719360, 1103823438336, 1103840346880, 1108135248640, 1108152157440, 282578783371776, 282578816992000, 282583095247360, 282583128867840, 283682606744320, 283682640430080, 283686918620160, 283686952306176, 283674000032256, 283678311842560, 283678328619520, 283682640430080, 284777823470080, 284782135345920, 284782152057600, 284786463933696, 566252783338240, 566257111925760, 566257111991040, 566261440578816, 567356606776320, 567360935429376, 567360935429376, 567365264082688, 282578783371776, 283678311842560, 282587390149120, 283686918620160, 283682623521280, 284782152057600, 283691230298880, 284790758835456, 565157566743040, 566257111991040, 565166173585920, 566265718834176, 566261406892800, 567360952206336, 566270013735936, 567369559049728, 566252783338240, 567356606776320, 566261406892800, 567365230331136, 567356623553280, 568460447056896, 567365247108096, 568469070611968, 848831566709760, 849935406925056, 848840190329856, 849944030545408, 849935406925056, 851039247205888, 849944030545408, 851047870826496, 1103823438336, 282578816992000, 2207646876160, 283682640430080, 2211941777920, 283686935397120, 3315765216000, 284790758835456, 283682623521280, 565157633852160, 284786447024640, 566261457355776, 284790741861120, 566265752257536, 285894565364736, 567369575761408, 284777823470080, 566257111991040, 285881663685120, 567360952206336, 285885941875200, 567365230461696, 286989782090496, 568469070677248, 567356623553280, 848835928851456, 568460463833856, 849939769132288, 568464741958656, 849944047322368, 569568582239488, 851047887603456, 283682606744320, 566257111925760, 284790725149440, 567365230331136, 284790741861120, 567365247108096, 285898860266496, 568473365513728, 566261406892800, 848835928851456, 567369525363456, 849944047322368, 567369542009856, 849944064034048, 568477660480768, 851052182505216, 567356606776320, 849935406925056, 568464741958656, 851043542107648, 568464741958656, 851043542172928, 569572877141248, 852151677355776, 849935406925056, 1132514223851008, 851043542172928, 1133622359099136, 851043542107648, 1133622359099136, 852151677355776, 1134730494347520, 4311876096, 1103840346880, 281483600396800, 282583128867840, 2207646876160, 3307175412480, 283686935397120, 284786463933696, 282587390149120, 283686935397120, 564066678735360, 565166223983616, 284790725149440, 285890270462976, 566270013735936, 567369559049728, 283678328619520, 284782152057600, 565157633917440, 566261457355776, 285881663685120, 286985487188736, 567360968983296, 568464792487168, 566261406892800, 567365247108096, 847740712256256, 848844552471808, 568464741958656, 569568582239488, 849944047322368, 851047887603456, 282583095247360, 284782135345920, 564066678735360, 566265718834176, 284786447024640, 286985487188736, 566270030512896, 568469070677248, 565166173585920, 567365230461696, 846649757139456, 848848814015488, 567369525363456, 569568582304768, 848853108917248, 851052165858816, 566257111991040, 568460447056896, 847740712256256, 849944047322368, 568460463833856, 570663798965248, 849944064099328, 852147399230976, 848840190329856, 851043542172928, 1130323790660608, 1132527142503936, 851043542172928, 853246894081536, 1132527142503936, 1134730494412800, 1108135248640, 283682640430080, 283686935397120, 566261440578816, 3315765216000, 285890270462976, 285894565364736, 568469070611968, 283691230298880, 566265752257536, 566270030512896, 848844552471808, 285898860266496, 568473382290688, 568477660480768, 851052182505216, 284782152057600, 567360952206336, 567360968983296, 849939769132288, 286989782090496, 569568582304768, 569568599016448, 852147399230976, 567365247108096, 849944064034048, 849944064099328, 1132522881025536, 569572877141248, 852151694132736, 852151694132736, 1134730511124480, 283686918620160, 567360935429376, 566270013735936, 849944030545408, 285894565364736, 569568582239488, 568477660480768, 852151677355776, 566270013735936, 849944047322368, 848853108917248, 1132527142503936, 568477660480768, 852151694132736, 851060755662336, 1134734789314560, 567360935429376, 851039247205888, 849944047322368, 1133622359099136, 569568582239488, 853246894081536, 852151694132736, 1135830005975040, 849944030545408, 1133622359099136, 1132527142503936, 1416205471057920, 852151677355776, 1135830005975040, 1134734789314560, 1418413117934080, 16909056, 4328719360, 1103840346880, 1108152157440, 282578816992000, 282583128867840, 283682640430080, 283686952306176, 283678311842560, 283682640430080, 284782135345920, 284786463933696, 566257111925760, 566261440578816, 567360935429376, 567365264082688, 283678311842560, 283686918620160, 284782152057600, 284790758835456, 566257111991040, 566265718834176, 567360952206336, 567369559049728, 567356606776320, 567365230331136, 568460447056896, 568469070611968, 849935406925056, 849944030545408, 851039247205888, 851047870826496, 282578816992000, 283682640430080, 283686935397120, 284790758835456, 565157633852160, 566261457355776, 566265752257536, 567369575761408, 566257111991040, 567360952206336, 567365230461696, 568469070677248, 848835928851456, 849939769132288, 849944047322368, 851047887603456, 566257111925760, 567365230331136, 567365247108096, 568473365513728, 848835928851456, 849944047322368, 849944064034048, 851052182505216, 849935406925056, 851043542107648, 851043542172928, 852151677355776, 1132514223851008, 1133622359099136, 1133622359099136, 1134730494347520, 1103840346880, 282583128867840, 3307175412480, 284786463933696, 283686935397120, 565166223983616, 285890270462976, 567369559049728, 284782152057600, 566261457355776, 286985487188736, 568464792487168, 567365247108096, 848844552471808, 569568582239488, 851047887603456, 284782135345920, 566265718834176, 286985487188736, 568469070677248, 567365230461696, 848848814015488, 569568582304768, 851052165858816, 568460447056896, 849944047322368, 570663798965248, 852147399230976, 851043542172928, 1132527142503936, 853246894081536, 1134730494412800, 283682640430080, 566261440578816, 285890270462976, 568469070611968, 566265752257536, 848844552471808, 568473382290688, 851052182505216, 567360952206336, 849939769132288, 569568582304768, 852147399230976, 849944064034048, 1132522881025536, 852151694132736, 1134730511124480, 567360935429376, 849944030545408, 569568582239488, 852151677355776, 849944047322368, 1132527142503936, 852151694132736, 1134734789314560, 851039247205888, 1133622359099136, 853246894081536, 1135830005975040, 1133622359099136, 1416205471057920, 1135830005975040, 1418413117934080, 4328719360, 1108152157440, 282583128867840, 283686952306176, 283682640430080, 284786463933696, 566261440578816, 567365264082688, 283686918620160, 284790758835456, 566265718834176, 567369559049728, 567365230331136, 568469070611968, 849944030545408, 851047870826496, 283682640430080, 284790758835456, 566261457355776, 567369575761408, 567360952206336, 568469070677248, 849939769132288, 851047887603456, 567365230331136, 568473365513728, 849944047322368, 851052182505216, 851043542107648, 852151677355776, 1133622359099136, 1134730494347520, 282583128867840, 284786463933696, 565166223983616, 567369559049728, 566261457355776, 568464792487168, 848844552471808, 851047887603456, 566265718834176, 568469070677248, 848848814015488, 851052165858816, 849944047322368, 852147399230976, 1132527142503936, 1134730494412800, 566261440578816, 568469070611968, 848844552471808, 851052182505216, 849939769132288, 852147399230976, 1132522881025536, 1134730511124480, 849944030545408, 852151677355776, 1132527142503936, 1134734789314560, 1133622359099136, 1135830005975040, 1416205471057920, 1418413117934080, 1108152157440, 283686952306176, 284786463933696, 567365264082688, 284790758835456, 567369559049728, 568469070611968, 851047870826496, 284790758835456, 567369575761408, 568469070677248, 851047887603456, 568473365513728, 851052182505216, 852151677355776, 1134730494347520, 284786463933696, 567369559049728, 568464792487168, 851047887603456, 568469070677248, 851052165858816, 852147399230976, 1134730494412800, 568469070611968, 851052182505216, 852147399230976, 1134730511124480, 852151677355776, 1134734789314560, 1135830005975040, 1418413117934080, 283686952306176, 567365264082688, 567369559049728, 851047870826496, 567369575761408, 851047887603456, 851052182505216, 1134730494347520, 567369559049728, 851047887603456, 851052165858816, 1134730494412800, 851052182505216, 1134730511124480, 1134734789314560, 1418413117934080, 567365264082688, 851047870826496, 851047887603456, 1134730494347520, 851047887603456, 1134730494412800, 1134730511124480, 1418413117934080, 851047870826496, 1134730494347520, 1134730494412800, 1418413117934080, 1134730494347520, 1418413117934080, 1418413117934080, 1702095741520896};
-static const uint64_t pcsize[4096] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11, 8, 9, 9, 10, 9, 10, 10, 11, 9, 10, 10, 11, 10, 11, 11, 12};
-static const uint64_t pcscale[4096] = {16777215, 7026091, 14052182, 4333826, 11327149, 2626729, 8667652, 0, 5881178, 4797706, 5253458, 4202754, 562184, 529416, 0, 0, 11758261, 2302113, 9595412, 139264, 10502821, 2097313, 8405508, 0, 1124368, 73728, 1058832, 8192, 0, 0, 0, 0, 6739307, 6427947, 4604226, 4325634, 2413609, 2102313, 278528, 0, 4232522, 4199690, 4194626, 4194562, 37896, 5128, 0, 0, 2244641, 2228257, 147456, 131072, 2113569, 2097185, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13478614, 4792450, 12855894, 4202498, 9208452, 524416, 8651268, 0, 4827218, 4792322, 4204626, 4202498, 557056, 524288, 0, 0, 8465044, 73856, 8399380, 8192, 8389252, 128, 8389124, 0, 75792, 73728, 10256, 8192, 0, 0, 0, 0, 4489282, 4194306, 4456514, 4194306, 294912, 0, 262144, 0, 4227138, 4194306, 4194370, 4194306, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10180013, 726441, 9584900, 131328, 8934573, 529577, 8404996, 0, 1643784, 595208, 1048832, 256, 529416, 529416, 0, 0, 9650341, 196769, 9584644, 131072, 8405157, 161, 8404996, 0, 1114112, 65536, 1048576, 0, 0, 0, 0, 0, 152873, 136489, 147712, 131328, 21545, 5161, 16384, 0, 5384, 5384, 256, 256, 5128, 5128, 0, 0, 147489, 131105, 147456, 131072, 16417, 33, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8978564, 589952, 8388612, 0, 8913028, 524416, 8388612, 0, 589824, 589824, 0, 0, 524288, 524288, 0, 0, 8454276, 65664, 8388612, 0, 8388740, 128, 8388612, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3586906, 2240778, 1452882, 139522, 2396680, 2101256, 262656, 0, 1096026, 12554, 1059154, 8450, 36872, 4104, 0, 0, 3287568, 2236416, 1190416, 139264, 2097664, 2097152, 512, 0, 1058832, 8192, 1058832, 8192, 0, 0, 0, 0, 2527562, 2232586, 393538, 131330, 2396168, 2101256, 262144, 0, 37194, 4362, 322, 258, 36872, 4104, 0, 0, 2228224, 2228224, 131072, 131072, 2097152, 2097152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305746, 8194, 272978, 8194, 295424, 0, 262656, 0, 43090, 8194, 10322, 8194, 32768, 0, 0, 0, 10768, 8192, 10768, 8192, 512, 0, 512, 0, 10256, 8192, 10256, 8192, 0, 0, 0, 0, 294978, 2, 262210, 2, 294912, 0, 262144, 0, 32834, 2, 66, 2, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1184008, 135432, 1179904, 131328, 4104, 4104, 0, 0, 1052936, 4360, 1048832, 256, 4104, 4104, 0, 0, 1179648, 131072, 1179648, 131072, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 135432, 135432, 131328, 131328, 4104, 4104, 0, 0, 4360, 4360, 256, 256, 4104, 4104, 0, 0, 131072, 131072, 131072, 131072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7169717, 6890657, 4481556, 4202496, 2901669, 2622625, 279044, 0, 4793360, 4793344, 4202512, 4202496, 525312, 525312, 0, 0, 2187957, 2171041, 25108, 8192, 2114213, 2097313, 16900, 0, 73744, 73728, 8208, 8192, 0, 0, 0, 0, 6571041, 6292513, 4472832, 4194304, 2376737, 2098209, 278528, 0, 4195328, 4195328, 4194304, 4194304, 1024, 1024, 0, 0, 2113569, 2097185, 16384, 0, 2113569, 2097185, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5055124, 4792448, 4465172, 4202496, 787076, 524416, 262660, 0, 4792336, 4792320, 4202512, 4202496, 524288, 524288, 0, 0, 74388, 73856, 8724, 8192, 644, 128, 516, 0, 73744, 73728, 8208, 8192, 0, 0, 0, 0, 4456448, 4194304, 4456448, 4194304, 262144, 0, 262144, 0, 4194304, 4194304, 4194304, 4194304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 607397, 591009, 16388, 0, 541861, 525473, 16388, 0, 590848, 590848, 0, 0, 525312, 525312, 0, 0, 82085, 65697, 16388, 0, 16549, 161, 16388, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 17441, 1057, 16384, 0, 17441, 1057, 16384, 0, 1024, 1024, 0, 0, 1024, 1024, 0, 0, 16417, 33, 16384, 0, 16417, 33, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 589956, 589952, 4, 0, 524420, 524416, 4, 0, 589824, 589824, 0, 0, 524288, 524288, 0, 0, 65668, 65664, 4, 0, 132, 128, 4, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2368016, 2105344, 270864, 8192, 2359808, 2097152, 262656, 0, 8208, 8192, 8208, 8192, 0, 0, 0, 0, 2105872, 2105344, 8720, 8192, 2097664, 2097152, 512, 0, 8208, 8192, 8208, 8192, 0, 0, 0, 0, 2359296, 2097152, 262144, 0, 2359296, 2097152, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2097152, 2097152, 0, 0, 2097152, 2097152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 270864, 8192, 270864, 8192, 262656, 0, 262656, 0, 8208, 8192, 8208, 8192, 0, 0, 0, 0, 8720, 8192, 8720, 8192, 512, 0, 512, 0, 8208, 8192, 8208, 8192, 0, 0, 0, 0, 262144, 0, 262144, 0, 262144, 0, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14339434, 4850986, 13781314, 4325634, 8963112, 525352, 8404992, 0, 5803338, 4719882, 5245250, 4194562, 558088, 525320, 0, 0, 9586720, 131104, 9586688, 131072, 8405024, 32, 8404992, 0, 1050624, 0, 1050624, 0, 0, 0, 0, 0, 4375914, 4326698, 4342082, 4325634, 50216, 1064, 16384, 0, 4228426, 4195594, 4194626, 4194562, 33800, 1032, 0, 0, 147488, 131104, 147456, 131072, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13142082, 4718594, 12585026, 4194306, 8945664, 524288, 8388608, 0, 4753474, 4718594, 4196418, 4194306, 557056, 524288, 0, 0, 8390656, 0, 8390656, 0, 8388608, 0, 8388608, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 4227138, 4194306, 4194370, 4194306, 32768, 0, 0, 0, 4227138, 4194306, 4194370, 4194306, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10110248, 656680, 9584896, 131328, 8930344, 525352, 8404992, 0, 1574152, 525576, 1048832, 256, 525320, 525320, 0, 0, 9584672, 131104, 9584640, 131072, 8405024, 32, 8404992, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 148776, 132392, 147712, 131328, 17448, 1064, 16384, 0, 1288, 1288, 256, 256, 1032, 1032, 0, 0, 147488, 131104, 147456, 131072, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8912896, 524288, 8388608, 0, 8912896, 524288, 8388608, 0, 524288, 524288, 0, 0, 524288, 524288, 0, 0, 8388608, 0, 8388608, 0, 8388608, 0, 8388608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1214794, 131338, 1182018, 131330, 32776, 8, 0, 0, 1083722, 266, 1050946, 258, 32776, 8, 0, 0, 1181696, 131072, 1181696, 131072, 0, 0, 0, 0, 1050624, 0, 1050624, 0, 0, 0, 0, 0, 164170, 131338, 131394, 131330, 32776, 8, 0, 0, 33098, 266, 322, 258, 32776, 8, 0, 0, 131072, 131072, 131072, 131072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34882, 2, 2114, 2, 32768, 0, 0, 0, 34882, 2, 2114, 2, 32768, 0, 0, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 32834, 2, 66, 2, 32768, 0, 0, 0, 32834, 2, 66, 2, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1179912, 131336, 1179904, 131328, 8, 8, 0, 0, 1048840, 264, 1048832, 256, 8, 8, 0, 0, 1179648, 131072, 1179648, 131072, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 131336, 131336, 131328, 131328, 8, 8, 0, 0, 264, 264, 256, 256, 8, 8, 0, 0, 131072, 131072, 131072, 131072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4736032, 4719648, 4210688, 4194304, 541728, 525344, 16384, 0, 4719616, 4719616, 4194304, 4194304, 525312, 525312, 0, 0, 16416, 32, 16384, 0, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4211744, 4195360, 4210688, 4194304, 17440, 1056, 16384, 0, 4195328, 4195328, 4194304, 4194304, 1024, 1024, 0, 0, 16416, 32, 16384, 0, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4718592, 4718592, 4194304, 4194304, 524288, 524288, 0, 0, 4718592, 4718592, 4194304, 4194304, 524288, 524288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4194304, 4194304, 4194304, 4194304, 0, 0, 0, 0, 4194304, 4194304, 4194304, 4194304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541728, 525344, 16384, 0, 541728, 525344, 16384, 0, 525312, 525312, 0, 0, 525312, 525312, 0, 0, 16416, 32, 16384, 0, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17440, 1056, 16384, 0, 17440, 1056, 16384, 0, 1024, 1024, 0, 0, 1024, 1024, 0, 0, 16416, 32, 16384, 0, 16416, 32, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524288, 524288, 0, 0, 524288, 524288, 0, 0, 524288, 524288, 0, 0, 524288, 524288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11901653, 2166913, 9701972, 0, 10785413, 2101377, 8651268, 0, 1153104, 69632, 1050704, 0, 36864, 4096, 0, 0, 11602581, 2162817, 9439764, 0, 10486405, 2097281, 8389124, 0, 1116176, 65536, 1050640, 0, 0, 0, 0, 0, 2396225, 2101249, 262208, 0, 2396161, 2101249, 262144, 0, 36928, 4096, 64, 0, 36864, 4096, 0, 0, 2097153, 2097153, 0, 0, 2097153, 2097153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8751828, 65664, 8653396, 0, 8684164, 128, 8651268, 0, 100432, 65536, 2128, 0, 32768, 0, 0, 0, 8456852, 65664, 8391188, 0, 8389252, 128, 8389124, 0, 67600, 65536, 2064, 0, 0, 0, 0, 0, 294976, 0, 262208, 0, 294912, 0, 262144, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9506949, 69761, 9437188, 0, 8392837, 4225, 8388612, 0, 1118208, 69632, 1048576, 0, 4096, 4096, 0, 0, 9502853, 65665, 9437188, 0, 8388741, 129, 8388612, 0, 1114112, 65536, 1048576, 0, 0, 0, 0, 0, 4097, 4097, 0, 0, 4097, 4097, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8454276, 65664, 8388612, 0, 8388740, 128, 8388612, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 8454276, 65664, 8388612, 0, 8388740, 128, 8388612, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3447376, 2101248, 1313360, 0, 2396672, 2101248, 262656, 0, 1087568, 4096, 1050704, 0, 36864, 4096, 0, 0, 3148304, 2097152, 1051152, 0, 2097664, 2097152, 512, 0, 1050640, 0, 1050640, 0, 0, 0, 0, 0, 2396224, 2101248, 262208, 0, 2396160, 2101248, 262144, 0, 36928, 4096, 64, 0, 36864, 4096, 0, 0, 2097152, 2097152, 0, 0, 2097152, 2097152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 297552, 0, 264784, 0, 295424, 0, 262656, 0, 34896, 0, 2128, 0, 32768, 0, 0, 0, 2576, 0, 2576, 0, 512, 0, 512, 0, 2064, 0, 2064, 0, 0, 0, 0, 0, 294976, 0, 262208, 0, 294912, 0, 262144, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1052672, 4096, 1048576, 0, 4096, 4096, 0, 0, 1052672, 4096, 1048576, 0, 4096, 4096, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2425493, 2162817, 262676, 0, 2359941, 2097281, 262660, 0, 65552, 65536, 16, 0, 0, 0, 0, 0, 2163349, 2162817, 532, 0, 2097797, 2097281, 516, 0, 65552, 65536, 16, 0, 0, 0, 0, 0, 2359297, 2097153, 262144, 0, 2359297, 2097153, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2097153, 2097153, 0, 0, 2097153, 2097153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328340, 65664, 262676, 0, 262788, 128, 262660, 0, 65552, 65536, 16, 0, 0, 0, 0, 0, 66196, 65664, 532, 0, 644, 128, 516, 0, 65552, 65536, 16, 0, 0, 0, 0, 0, 262144, 0, 262144, 0, 262144, 0, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65669, 65665, 4, 0, 133, 129, 4, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 65669, 65665, 4, 0, 133, 129, 4, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65668, 65664, 4, 0, 132, 128, 4, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 65668, 65664, 4, 0, 132, 128, 4, 0, 65536, 65536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2359824, 2097152, 262672, 0, 2359808, 2097152, 262656, 0, 16, 0, 16, 0, 0, 0, 0, 0, 2097680, 2097152, 528, 0, 2097664, 2097152, 512, 0, 16, 0, 16, 0, 0, 0, 0, 0, 2359296, 2097152, 262144, 0, 2359296, 2097152, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2097152, 2097152, 0, 0, 2097152, 2097152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262672, 0, 262672, 0, 262656, 0, 262656, 0, 16, 0, 16, 0, 0, 0, 0, 0, 528, 0, 528, 0, 512, 0, 512, 0, 16, 0, 16, 0, 0, 0, 0, 0, 262144, 0, 262144, 0, 262144, 0, 262144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9472064, 0, 9439296, 0, 8421376, 0, 8388608, 0, 1083456, 0, 1050688, 0, 32768, 0, 0, 0, 9439232, 0, 9439232, 0, 8388608, 0, 8388608, 0, 1050624, 0, 1050624, 0, 0, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8423488, 0, 8390720, 0, 8421376, 0, 8388608, 0, 34880, 0, 2112, 0, 32768, 0, 0, 0, 8390656, 0, 8390656, 0, 8388608, 0, 8388608, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9437184, 0, 9437184, 0, 8388608, 0, 8388608, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 9437184, 0, 9437184, 0, 8388608, 0, 8388608, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8388608, 0, 8388608, 0, 8388608, 0, 8388608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8388608, 0, 8388608, 0, 8388608, 0, 8388608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1083456, 0, 1050688, 0, 32768, 0, 0, 0, 1083456, 0, 1050688, 0, 32768, 0, 0, 0, 1050624, 0, 1050624, 0, 0, 0, 0, 0, 1050624, 0, 1050624, 0, 0, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34880, 0, 2112, 0, 32768, 0, 0, 0, 34880, 0, 2112, 0, 32768, 0, 0, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 2048, 0, 2048, 0, 0, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 32832, 0, 64, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 1048576, 0, 1048576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-static const uint64_t istriad[4096] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-static const uint64_t tonnetz[4096] = {0, 0, 0, 2, 0, 2, 2, 4, 0, 1, 2, 3, 2, 3, 4, 5, 0, 1, 1, 2, 2, 3, 3, 4, 2, 2, 3, 3, 4, 4, 5, 5, 0, 1, 1, 2, 1, 2, 2, 4, 2, 2, 3, 3, 3, 3, 4, 5, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 0, 2, 1, 3, 1, 3, 2, 4, 1, 2, 2, 3, 2, 3, 4, 5, 2, 3, 2, 3, 3, 4, 3, 4, 3, 3, 3, 4, 4, 4, 5, 5, 2, 3, 2, 3, 2, 3, 3, 4, 3, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 0, 1, 2, 3, 1, 2, 3, 4, 1, 2, 3, 4, 2, 3, 4, 5, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 4, 4, 5, 5, 2, 2, 3, 3, 2, 3, 3, 4, 3, 3, 4, 4, 3, 4, 4, 5, 3, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 5, 5, 5, 6, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 0, 1, 1, 2, 2, 3, 3, 4, 1, 2, 2, 3, 3, 4, 4, 5, 1, 2, 2, 3, 3, 4, 4, 5, 2, 3, 3, 4, 4, 5, 5, 6, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 5, 5, 5, 6, 2, 3, 2, 3, 3, 4, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 3, 4, 4, 5, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 2, 2, 3, 3, 3, 3, 4, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 3, 4, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 0, 1, 1, 2, 1, 2, 2, 4, 2, 2, 3, 3, 3, 3, 4, 5, 1, 2, 2, 3, 2, 3, 3, 4, 3, 3, 4, 4, 4, 4, 5, 5, 1, 2, 2, 3, 2, 3, 3, 4, 3, 3, 4, 4, 4, 4, 5, 5, 2, 3, 3, 4, 3, 4, 4, 5, 4, 4, 5, 5, 5, 5, 6, 6, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 2, 2, 3, 3, 2, 3, 3, 4, 3, 3, 4, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 3, 4, 4, 3, 4, 4, 5, 4, 4, 5, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 3, 4, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 5, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 2, 2, 3, 3, 3, 3, 4, 3, 3, 3, 4, 4, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 3, 3, 4, 4, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 5, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 6, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 0, 2, 1, 3, 1, 3, 2, 4, 1, 2, 2, 3, 2, 3, 4, 5, 2, 3, 2, 3, 3, 4, 3, 4, 3, 3, 3, 4, 4, 4, 5, 5, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 3, 3, 3, 4, 4, 4, 4, 5, 4, 4, 4, 5, 5, 5, 5, 6, 1, 3, 2, 4, 2, 4, 3, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 3, 4, 4, 5, 4, 5, 4, 4, 4, 5, 5, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 5, 5, 5, 6, 5, 5, 5, 6, 6, 6, 6, 7, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 2, 3, 3, 4, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 3, 4, 4, 5, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 3, 4, 4, 5, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 5, 6, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 3, 3, 4, 4, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 4, 4, 5, 5, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 2, 3, 2, 3, 2, 3, 3, 4, 3, 3, 3, 4, 3, 4, 4, 5, 3, 4, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 4, 4, 5, 5, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 5, 5, 6, 6, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 0, 2, 2, 4, 1, 3, 3, 5, 1, 2, 3, 4, 2, 3, 4, 5, 1, 2, 2, 4, 2, 3, 3, 5, 2, 3, 3, 4, 4, 4, 5, 5, 2, 3, 3, 4, 2, 3, 3, 5, 3, 3, 4, 4, 3, 4, 4, 5, 3, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 5, 5, 5, 6, 1, 3, 2, 4, 2, 4, 3, 5, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 1, 2, 3, 4, 2, 3, 4, 5, 2, 3, 4, 5, 3, 4, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 3, 4, 4, 3, 4, 4, 5, 4, 4, 5, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 5, 5, 5, 6, 5, 6, 6, 7, 6, 6, 6, 7, 6, 7, 7, 8, 1, 2, 2, 4, 2, 3, 3, 5, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 2, 3, 3, 4, 2, 3, 3, 5, 3, 3, 4, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 3, 4, 4, 5, 4, 4, 5, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 3, 4, 4, 3, 4, 4, 5, 4, 4, 5, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 4, 5, 5, 4, 5, 5, 6, 5, 5, 6, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 3, 3, 4, 3, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 4, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 2, 4, 3, 5, 2, 4, 3, 5, 2, 4, 3, 5, 3, 4, 4, 5, 3, 4, 3, 5, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 4, 3, 5, 3, 5, 4, 6, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 2, 4, 3, 5, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 3, 5, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 4, 5, 4, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 5, 5, 6, 5, 6, 6, 7, 6, 6, 6, 7, 6, 7, 7, 8, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 5, 6, 6, 7, 6, 7, 7, 8, 6, 7, 7, 8, 7, 8, 8, 9, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 6, 7, 7, 8, 7, 8, 8, 9, 7, 8, 8, 9, 8, 9, 9, 10, 7, 8, 8, 9, 8, 9, 9, 10, 8, 9, 9, 10, 9, 10, 10, 11};
-static const uint64_t dissfracnum[256] = {5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 1, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 2, 9, 3, 5, 1, 7, 3, 1, 5, 9, 15, 1, 4, 9, 3, 5, 1, 7, 3, 2, 5, 9, 15, 1, 8, 9, 3, 5, 2, 7, 3, 4, 5, 9, 15, 1, 16, 9, 6, 5, 4, 7, 3, 8, 5, 9, 15, 2, 32, 9, 12, 5, 8, 14, 3, 16, 10, 18, 15, 4, 64, 9, 24, 5, 16, 28, 6, 32, 20, 36, 15, 8, 128, 9, 48, 10, 32, 56, 12, 64, 40, 72, 15, 16, 256, 18, 96, 20, 64, 112, 24, 128, 80, 144, 30, 32, 512, 36, 192, 40, 128, 224, 48, 256, 160, 288, 60, 64, 1024, 72, 384, 80, 256, 448, 96, 512, 320, 576, 120, 128, 2048, 144, 768, 160, 512, 896, 192, 1024, 640, 1152, 240, 256, 4096, 288, 1536, 320, 1024, 1792, 384, 2048, 1280, 2304, 480, 512, 8192, 576, 3072, 640, 2048, 3584, 768, 4096, 2560, 4608, 960, 1024, 16384, 1152, 6144, 1280, 4096, 7168, 1536};
-static const uint64_t dissfracden[256] = {8192, 1536, 10240, 4096, 1280, 6144, 10240, 16384, 1024, 960, 8192, 2560, 4096, 768, 5120, 2048, 640, 3072, 5120, 8192, 512, 480, 4096, 1280, 2048, 384, 2560, 1024, 320, 1536, 2560, 4096, 256, 240, 2048, 640, 1024, 192, 1280, 512, 160, 768, 1280, 2048, 128, 120, 1024, 320, 512, 96, 640, 256, 80, 384, 640, 1024, 64, 60, 512, 160, 256, 48, 320, 128, 40, 192, 320, 512, 32, 30, 256, 80, 128, 24, 160, 64, 20, 96, 160, 256, 16, 15, 128, 40, 64, 12, 80, 32, 10, 48, 80, 128, 8, 15, 64, 20, 32, 6, 40, 16, 5, 24, 40, 64, 4, 15, 32, 10, 16, 3, 20, 8, 5, 12, 20, 32, 2, 15, 16, 5, 8, 3, 10, 4, 5, 6, 10, 16, 1, 15, 8, 5, 4, 3, 5, 2, 5, 3, 5, 8, 1, 15, 4, 5, 2, 3, 5, 1, 5, 3, 5, 4, 1, 15, 2, 5, 1, 3, 5, 1, 5, 3, 5, 2, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1, 5, 3, 5, 1, 1, 15, 1, 5, 1, 3, 5, 1};
+
+#include <stdint.h>
+
+// the attributes of every pitch class set (a 12 bit mask with C as the
+// LSB), built at compile time. the attributes a chord needs are packed into
+// one 8 byte record, so the whole table is 32KB and a lookup touches a
+// single cache line. each intermediate table is a constexpr object of its
+// own, which keeps every constant evaluation short.
+
+// a pitch class set transposed up by r semitones, for r in [0,12)
+constexpr int rotate_pcs(int pcs, int r) {
+  return ((pcs << r) | (pcs >> (12 - r))) & 0xfff;
+}
+
+// the prime form of each set, as its smallest transposition, and the
+// smallest transposition that gives it
+class PC_ROTATIONS {
+public:
+  uint16_t pcd[4096];
+  uint8_t rot[4096];
+
+  constexpr PC_ROTATIONS() : pcd(), rot() {
+    for (int x=0; x<4096; x++) {
+      int best = x;
+      int best_r = 0;
+      for (int r=1; r<12; r++) {
+        int y = rotate_pcs(x, r);
+        if (y < best) {
+          best = y;
+          best_r = r;
+        }
+      }
+      pcd[x] = best;
+      rot[x] = best_r;
+    }
+  }
+};
+
+// the size of each set, and the major and minor scales that contain it.
+// bit s is the major scale on s, and bit 12 + s the harmonic minor scale on
+// s. sets are built up one pitch class at a time.
+class PC_SCALES {
+public:
+  uint32_t scales[4096];
+  uint8_t size[4096];
+
+  constexpr PC_SCALES() : scales(), size() {
+    const int major = 0xab5;
+    const int minor = 0x9ad;
+    uint32_t containing[12] = {0}; // the scales containing each pitch class
+    for (int s=0; s<12; s++) {
+      for (int pc=0; pc<12; pc++) {
+        if ((rotate_pcs(major, s) >> pc) & 1) containing[pc] |= (1u << s);
+        if ((rotate_pcs(minor, s) >> pc) & 1) containing[pc] |= (1u << (12 + s));
+      }
+    }
+    scales[0] = (1u << 24) - 1;
+    for (int x=1; x<4096; x++) {
+      int lowest = 0;
+      while (!((x >> lowest) & 1)) lowest++;
+      scales[x] = scales[x & (x - 1)] & containing[lowest];
+      size[x] = size[x & (x - 1)] + 1;
+    }
+  }
+};
+
+// the pitch classes adjacent to pc on the tonnetz (a third or a fifth away)
+constexpr int tonnetz_neighbours(int pc) {
+  return rotate_pcs((1 << 3) | (1 << 4) | (1 << 5) | (1 << 7) | (1 << 8) | (1 << 9), pc);
+}
+
+// the shortest walk on the tonnetz through the pitch classes of a set, in
+// any order. any two pitch classes are at most two edges apart, so a walk
+// through n of them is n - 1 edges plus one for every step that is not
+// between neighbours. ends[x] holds the pitch classes a walk through x can
+// end at with at most k such steps, where k is the depth of the layer.
+class TONNETZ_LAYER {
+public:
+  uint16_t ends[4096];
+
+  constexpr TONNETZ_LAYER(const TONNETZ_LAYER *fewer) : ends() {
+    for (int x=1; x<4096; x++) {
+      int e = fewer ? fewer->ends[x] : 0;
+      for (int pc=0; pc<12; pc++) {
+        if (!((x >> pc) & 1)) continue;
+        int rest = x & ~(1 << pc);
+        if ((rest == 0) || (ends[rest] & tonnetz_neighbours(pc)) || (fewer && fewer->ends[rest])) {
+          e |= (1 << pc);
+        }
+      }
+      ends[x] = e;
+    }
+  }
+
+  constexpr bool covers_all() const {
+    for (int x=1; x<4096; x++) {
+      if (!ends[x]) return false;
+    }
+    return true;
+  }
+};
+
+static constexpr PC_ROTATIONS pc_rotations;
+static constexpr PC_SCALES pc_scales;
+static constexpr TONNETZ_LAYER tonnetz_layer_0(nullptr);
+static constexpr TONNETZ_LAYER tonnetz_layer_1(&tonnetz_layer_0);
+static constexpr TONNETZ_LAYER tonnetz_layer_2(&tonnetz_layer_1);
+static_assert(tonnetz_layer_2.covers_all(), "a tonnetz walk needs more than two steps between non-neighbours");
+
+class PC_SET {
+public:
+  uint32_t scales : 24; // see PC_SCALES
+  uint32_t size : 4; // the number of pitch classes
+  uint32_t tonnetz : 4; // the length of the shortest walk through them on the tonnetz
+  uint16_t pcd; // the prime form
+  uint8_t rot; // the transposition that gives the prime form
+};
+
+class PC_SET_TABLE {
+public:
+  PC_SET sets[4096];
+
+  constexpr PC_SET_TABLE() : sets() {
+    for (int x=0; x<4096; x++) {
+      PC_SET &s = sets[x];
+      s.scales = pc_scales.scales[x];
+      s.size = pc_scales.size[x];
+      s.tonnetz = 0;
+      if (s.size > 1) {
+        int steps = !tonnetz_layer_0.ends[x] + !tonnetz_layer_1.ends[x];
+        s.tonnetz = s.size - 1 + steps;
+      }
+      s.pcd = pc_rotations.pcd[x];
+      s.rot = pc_rotations.rot[x];
+    }
+  }
+
+  constexpr const PC_SET &operator[](int x) const {
+    return sets[x];
+  }
+};
+
+static constexpr PC_SET_TABLE pc_sets;
+static_assert(sizeof(PC_SET) == 8, "a PC_SET is packed into 8 bytes");
+
 #endif
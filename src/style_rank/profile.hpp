@@ -0,0 +1,405 @@
+#ifndef STYLE_RANK_PROFILE_H
+#define STYLE_RANK_PROFILE_H
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <stdint.h>
+
+using namespace std;
+
+// per-stage instrumentation of the extraction pipeline. while the profiler
+// is running, every PROFILE_SCOPE on a thread working for the profiled call
+// adds its wall time, the allocations made on its thread and the items it
+// processed to a per-thread table, and can also append a trace event, so
+// workers never contend for a lock. when the profiler is stopped a scope
+// costs a single relaxed load.
+
+// the fixed stages. features that are not fused get a stage of their own.
+enum PROFILE_STAGE_ID {
+  STAGE_EXTRACT, // extract_features
+  STAGE_PRESCAN, // counting the note-ons of a file before it is read
+  STAGE_READ, // read_smf_notes, including the fallback
+  STAGE_MIDIFILE_READ, // smf::MidiFile::read
+  STAGE_LINK_NOTE_PAIRS, // smf::MidiFile::linkNotePairs
+  STAGE_ARCHIVE, // MIDI_ARCHIVE::read (items are members)
+  STAGE_INFLATE, // inflating a member of a zip (items are bytes)
+  STAGE_NOTES, // quantizing and adding notes to a Piece (items are notes)
+  STAGE_CHORDS, // Piece::findChords (items are chords)
+  STAGE_CACHE, // PIECE_CACHE::get (items are hits)
+  STAGE_STORE_GET, // FEATURE_STORE::get (items are hits)
+  STAGE_STORE_PUT, // FEATURE_STORE::put
+  STAGE_FEATURES, // FusedExtractor (items are pieces)
+  STAGE_CHORD_PASS, // the fused chord features
+  STAGE_NOTE_PASS, // the fused note features
+  STAGE_COLLECT, // adding distributions to a collector
+  STAGE_DOMAINS, // choosing the domain of each feature
+  STAGE_MATRIX, // writing the feature matrices
+  N_PROFILE_STAGES
+};
+
+static const char *PROFILE_STAGE_NAMES[N_PROFILE_STAGES] = {
+  "extract",
+  "prescan",
+  "read",
+  "midifile_read",
+  "link_note_pairs",
+  "archive",
+  "inflate",
+  "notes",
+  "chords",
+  "cache",
+  "store_get",
+  "store_put",
+  "features",
+  "chord_pass",
+  "note_pass",
+  "collect",
+  "domains",
+  "matrix"
+};
+
+// why a piece was not featurized
+enum REJECT_REASON {
+  REJECT_EMPTY, // no note-ons, or unreadable
+  REJECT_FEW_ONSETS, // too few distinct onsets to have enough chords
+  REJECT_DRUM_ONLY, // every note-on is on the drum channel
+  REJECT_FEW_CHORDS, // too few chords once parsed
+  N_REJECT_REASONS
+};
+
+inline const char *reject_reason_name(REJECT_REASON reason) {
+  static constexpr const char *names[N_REJECT_REASONS] = {
+    "empty",
+    "too_few_onsets",
+    "drum_only",
+    "too_few_chords"
+  };
+  return names[reason];
+}
+
+// trace events kept per thread, beyond which they are counted as dropped
+static const size_t MAX_TRACE_EVENTS = 1 << 20;
+
+// the allocations made by each thread. counted by operator new when the
+// program is built with STYLE_RANK_COUNT_ALLOCATIONS (see the end of this
+// file), and zero otherwise.
+struct ALLOCATION_COUNT {
+  uint64_t count;
+  uint64_t bytes;
+};
+static thread_local ALLOCATION_COUNT thread_allocations = {0, 0};
+
+// whether the calling thread works for the profiled call. set by
+// PROFILER::start on the calling thread and inherited by the workers of
+// parallel_for, so concurrent calls that are not profiled are not counted.
+static thread_local bool thread_profiled = false;
+
+class STAGE_STATS {
+public:
+  uint64_t calls = 0;
+  uint64_t ns = 0; // wall time, including nested stages
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  uint64_t items = 0;
+
+  void merge(const STAGE_STATS &o) {
+    calls += o.calls;
+    ns += o.ns;
+    allocations += o.allocations;
+    allocated_bytes += o.allocated_bytes;
+    items += o.items;
+  }
+};
+
+class PROFILE_STATS {
+public:
+  map<string,STAGE_STATS> stages; // stages that were entered at least once
+  uint64_t ns = 0; // from start() to stop()
+  int threads = 0;
+  uint64_t dropped_events = 0;
+  uint64_t rejected[N_REJECT_REASONS] = {0}; // pieces, by REJECT_REASON
+  uint64_t memo_lookups = 0; // chords looked up in a CHORD_MEMO
+  uint64_t memo_hits = 0;
+};
+
+class PROFILER {
+public:
+  PROFILER() {
+    for (int i=0; i<N_PROFILE_STAGES; i++) {
+      stage(PROFILE_STAGE_NAMES[i]);
+    }
+  }
+
+  bool enabled() const {
+    return running.load(memory_order_relaxed) && thread_profiled;
+  }
+
+  // the id of a stage, registered on first use
+  int stage(const string &name) {
+    lock_guard<mutex> guard(lock);
+    auto it = ids.find(name);
+    if (it != ids.end()) return it->second;
+    ids[name] = names.size();
+    names.push_back(name);
+    return names.size() - 1;
+  }
+
+  // held by a profiled call from before start() until it has read its
+  // stats and trace, since start() discards the tables the workers of the
+  // previous call write to. one call is profiled at a time.
+  mutex session;
+
+  // discard previous results and start counting on the calling thread
+  void start(bool trace=false) {
+    lock_guard<mutex> guard(lock);
+    threads.clear();
+    generation++;
+    tracing = trace;
+    begin_ns = clock_ns();
+    end_ns = begin_ns;
+    thread_profiled = true;
+    running = true;
+  }
+
+  void stop() {
+    running = false;
+    thread_profiled = false;
+    end_ns = clock_ns();
+  }
+
+  uint64_t now() const {
+    return clock_ns();
+  }
+
+  void record(int stage, uint64_t begin, uint64_t end, uint64_t allocations, uint64_t allocated_bytes, uint64_t items) {
+    THREAD_DATA &t = local();
+    if ((size_t)stage >= t.stages.size()) {
+      t.stages.resize(stage + 1);
+    }
+    STAGE_STATS &s = t.stages[stage];
+    s.calls++;
+    s.ns += end - begin;
+    s.allocations += allocations;
+    s.allocated_bytes += allocated_bytes;
+    s.items += items;
+    if (tracing) {
+      if (t.events.size() < MAX_TRACE_EVENTS) {
+        t.events.push_back({stage, begin, end - begin});
+      }
+      else {
+        t.dropped++;
+      }
+    }
+  }
+
+  // count a piece that was not featurized
+  void reject(REJECT_REASON reason) {
+    if (enabled()) {
+      local().rejected[reason]++;
+    }
+  }
+
+  // count chords looked up in a CHORD_MEMO, and those that were found
+  void memo(uint64_t lookups, uint64_t hits) {
+    if (enabled()) {
+      THREAD_DATA &t = local();
+      t.memo_lookups += lookups;
+      t.memo_hits += hits;
+    }
+  }
+
+  // the totals over every thread since the last start
+  PROFILE_STATS stats() {
+    lock_guard<mutex> guard(lock);
+    PROFILE_STATS ret;
+    ret.ns = (running ? clock_ns() : end_ns) - begin_ns;
+    ret.threads = threads.size();
+    for (const auto &t : threads) {
+      for (size_t i=0; i<t->stages.size(); i++) {
+        if (t->stages[i].calls) {
+          ret.stages[names[i]].merge(t->stages[i]);
+        }
+      }
+      ret.dropped_events += t->dropped;
+      for (int i=0; i<N_REJECT_REASONS; i++) {
+        ret.rejected[i] += t->rejected[i];
+      }
+      ret.memo_lookups += t->memo_lookups;
+      ret.memo_hits += t->memo_hits;
+    }
+    return ret;
+  }
+
+  // the trace events since the last start, in the chrome trace event
+  // format (load it in chrome://tracing or https://ui.perfetto.dev).
+  // each worker is a thread of its own.
+  void write_trace(const string &path) {
+    lock_guard<mutex> guard(lock);
+    FILE *f = fopen(path.c_str(), "w");
+    if (!f) {
+      throw runtime_error("failed to open " + path);
+    }
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    for (const auto &t : threads) {
+      fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"worker %d\"}}", first ? "" : ",\n", t->id, t->id);
+      first = false;
+      for (const auto &e : t->events) {
+        fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+          json_escape(names[e.stage]).c_str(), t->id, (e.begin - begin_ns) / 1e3, e.duration / 1e3);
+      }
+    }
+    fprintf(f, "\n]}\n");
+    if (fclose(f) != 0) {
+      throw runtime_error("failed to write " + path);
+    }
+  }
+
+private:
+  struct TRACE_EVENT {
+    int stage;
+    uint64_t begin;
+    uint64_t duration;
+  };
+  struct THREAD_DATA {
+    int id;
+    vector<STAGE_STATS> stages;
+    vector<TRACE_EVENT> events;
+    uint64_t dropped = 0;
+    uint64_t rejected[N_REJECT_REASONS] = {0};
+    uint64_t memo_lookups = 0;
+    uint64_t memo_hits = 0;
+  };
+
+  atomic<bool> running{false};
+  atomic<uint64_t> generation{0};
+  bool tracing = false;
+  uint64_t begin_ns = 0;
+  uint64_t end_ns = 0;
+  mutex lock;
+  map<string,int> ids;
+  vector<string> names;
+  vector<unique_ptr<THREAD_DATA>> threads;
+
+  static uint64_t clock_ns() {
+    return chrono::duration_cast<chrono::nanoseconds>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  static string json_escape(const string &s) {
+    string ret;
+    for (char c : s) {
+      if ((c == '"') || (c == '\\')) ret += '\\';
+      if ((unsigned char)c >= 0x20) ret += c;
+    }
+    return ret;
+  }
+
+  // the table of the calling thread, which is registered the first time it
+  // records anything after a start
+  THREAD_DATA &local() {
+    static thread_local THREAD_DATA *data = nullptr;
+    static thread_local uint64_t data_generation = 0;
+    uint64_t g = generation.load(memory_order_relaxed);
+    if (!data || (data_generation != g)) {
+      lock_guard<mutex> guard(lock);
+      threads.push_back(unique_ptr<THREAD_DATA>(new THREAD_DATA()));
+      threads.back()->id = threads.size() - 1;
+      data = threads.back().get();
+      data_generation = g;
+    }
+    return *data;
+  }
+};
+
+static PROFILER profiler;
+
+// times the enclosing block as one call of a stage. items processed in the
+// block can be added with count().
+class PROFILE_SCOPE {
+public:
+  PROFILE_SCOPE(int _stage) : stage(_stage), active(profiler.enabled()) {
+    if (active) {
+      allocations = thread_allocations;
+      begin = profiler.now();
+    }
+  }
+  ~PROFILE_SCOPE() {
+    if (active) {
+      uint64_t end = profiler.now();
+      profiler.record(stage, begin, end,
+        thread_allocations.count - allocations.count,
+        thread_allocations.bytes - allocations.bytes, items);
+    }
+  }
+  PROFILE_SCOPE(const PROFILE_SCOPE&) = delete;
+  PROFILE_SCOPE& operator=(const PROFILE_SCOPE&) = delete;
+
+  void count(uint64_t n) {
+    items += n;
+  }
+
+private:
+  int stage;
+  bool active;
+  uint64_t begin = 0;
+  uint64_t items = 0;
+  ALLOCATION_COUNT allocations = {0, 0};
+};
+
+// replaceable allocation functions that count into thread_allocations.
+// they replace the allocator of the whole program, so they are opt-in:
+// they are only compiled where STYLE_RANK_COUNT_ALLOCATIONS is defined
+// (e.g. CFLAGS=-DSTYLE_RANK_COUNT_ALLOCATIONS when building the extension),
+// which must be in exactly one translation unit of a program. every form of
+// new and delete goes through counted_allocate and counted_release, which
+// are not inlined, so the compiler sees each new matched with a delete.
+#ifdef STYLE_RANK_COUNT_ALLOCATIONS
+#if defined(__GNUC__)
+#define STYLE_RANK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define STYLE_RANK_NOINLINE __declspec(noinline)
+#else
+#define STYLE_RANK_NOINLINE
+#endif
+
+STYLE_RANK_NOINLINE static void *counted_allocate(size_t size) noexcept {
+  thread_allocations.count++;
+  thread_allocations.bytes += size;
+  return malloc(size ? size : 1);
+}
+
+STYLE_RANK_NOINLINE static void counted_release(void *p) noexcept {
+  free(p);
+}
+
+void *operator new(size_t size) {
+  void *p = counted_allocate(size);
+  if (!p) throw bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) {
+  void *p = counted_allocate(size);
+  if (!p) throw bad_alloc();
+  return p;
+}
+void *operator new(size_t size, const nothrow_t&) noexcept { return counted_allocate(size); }
+void *operator new[](size_t size, const nothrow_t&) noexcept { return counted_allocate(size); }
+void operator delete(void *p) noexcept { counted_release(p); }
+void operator delete[](void *p) noexcept { counted_release(p); }
+void operator delete(void *p, size_t) noexcept { counted_release(p); }
+void operator delete[](void *p, size_t) noexcept { counted_release(p); }
+void operator delete(void *p, const nothrow_t&) noexcept { counted_release(p); }
+void operator delete[](void *p, const nothrow_t&) noexcept { counted_release(p); }
+#endif
+
+#endif
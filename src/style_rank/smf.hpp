@@ -0,0 +1,372 @@
+#ifndef STYLE_RANK_SMF_H
+#define STYLE_RANK_SMF_H
+
+#include <vector>
+#include <string>
+#include <climits>
+#include <fstream>
+#include <iterator>
+#include <istream>
+#include <streambuf>
+#include <stdint.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "./deps/MidiFile.h"
+#include "utils.hpp"
+#include "profile.hpp"
+
+using namespace std;
+
+// the note-ons of a standard midi file, in the order Piece reads them
+// (track by track, in file order). durations are in ticks and are 0 for
+// notes that were never released.
+class SMF_NOTES {
+public:
+  int ticks = 0;
+  int track_count = 0;
+  vector<int> pitch, onset, duration, velocity;
+
+  void clear() {
+    ticks = 0;
+    track_count = 0;
+    pitch.clear();
+    onset.clear();
+    duration.clear();
+    velocity.clear();
+  }
+  size_t size() const {
+    return pitch.size();
+  }
+};
+
+// the note-ons of a standard midi file, counted without pairing them
+class SMF_SCAN {
+public:
+  uint32_t note_ons[16]; // by channel
+  vector<int> onsets; // the tick of each note-on
+
+  void clear() {
+    fill(note_ons, note_ons + 16, 0);
+    onsets.clear();
+  }
+  uint32_t size() const {
+    return onsets.size();
+  }
+};
+
+// a read-only view of a whole file, memory mapped where possible
+class MAPPED_FILE {
+public:
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+
+  MAPPED_FILE(const string &path) {
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0)) {
+      void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr != MAP_FAILED) {
+        data = (const uint8_t*)addr;
+        size = st.st_size;
+        mapped = true;
+      }
+    }
+    close(fd);
+#endif
+    if (!mapped) {
+      ifstream input(path, ios::binary);
+      buffer.assign(istreambuf_iterator<char>(input), istreambuf_iterator<char>());
+      data = (const uint8_t*)buffer.data();
+      size = buffer.size();
+    }
+  }
+  ~MAPPED_FILE() {
+#ifndef _WIN32
+    if (mapped) munmap((void*)data, size);
+#endif
+  }
+  MAPPED_FILE(const MAPPED_FILE&) = delete;
+  MAPPED_FILE& operator=(const MAPPED_FILE&) = delete;
+
+private:
+  bool mapped = false;
+  vector<char> buffer;
+};
+
+// decodes the notes of a standard midi file in place, without building
+// events. it accepts exactly the files smf::MidiFile::read accepts without
+// error and pairs notes the way MidiEventList::linkNotePairs does (a
+// note-off releases the most recent unreleased note-on of the same channel
+// and key, within a track). anything else (truncated or malformed data,
+// smpte time, binasc text, the rare encodings midifile reads in its own
+// way) is rejected, so the caller can fall back to smf::MidiFile and get
+// the same notes it always did.
+class SMF_READER {
+public:
+  bool operator()(const uint8_t *data, size_t size, SMF_NOTES &out) {
+    out.clear();
+    return read(data, size, &out, nullptr);
+  }
+
+  // count the note-ons of a file, accepting exactly the files operator()
+  // accepts
+  bool scan(const uint8_t *data, size_t size, SMF_SCAN &out) {
+    out.clear();
+    return read(data, size, nullptr, &out);
+  }
+
+private:
+  const uint8_t *p = nullptr;
+  const uint8_t *e = nullptr;
+  vector<int> pending; // the previous unreleased note-on of the same key
+
+  bool read(const uint8_t *data, size_t size, SMF_NOTES *notes, SMF_SCAN *scan) {
+    pending.clear();
+    p = data;
+    e = data + size;
+
+    uint32_t header_size;
+    uint16_t format, tracks, division;
+    if (!tag("MThd") || !be32(header_size) || (header_size != 6)) return false;
+    if (!be16(format) || !be16(tracks) || !be16(division)) return false;
+    if ((format > 1) || ((format == 0) && (tracks != 1))) return false;
+    if (division >= 0x8000) return false; // smpte
+
+    if (notes) {
+      notes->ticks = division;
+      notes->track_count = tracks;
+    }
+    for (int track=0; track<tracks; track++) {
+      if (!read_track(notes, scan)) return false;
+    }
+    return true;
+  }
+
+  bool byte(uint8_t &x) {
+    if (p >= e) return false;
+    x = *p++;
+    return true;
+  }
+  bool skip(uint32_t n) {
+    if ((size_t)(e - p) < n) return false;
+    p += n;
+    return true;
+  }
+  bool tag(const char *t) {
+    if ((e - p < 4) || !equal(t, t + 4, p)) return false;
+    p += 4;
+    return true;
+  }
+  bool be16(uint16_t &x) {
+    if (e - p < 2) return false;
+    x = (p[0] << 8) | p[1];
+    p += 2;
+    return true;
+  }
+  bool be32(uint32_t &x) {
+    if (e - p < 4) return false;
+    x = ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    p += 4;
+    return true;
+  }
+  // variable length values of at most four bytes
+  bool vlv(uint32_t &x) {
+    x = 0;
+    uint8_t b;
+    for (int i=0; i<4; i++) {
+      if (!byte(b)) return false;
+      x = (x << 7) | (b & 0x7f);
+      if (b < 0x80) return true;
+    }
+    return false;
+  }
+  // meta event lengths, where midifile reads a second byte of exactly
+  // 0x80 differently from the standard
+  bool meta_length(uint32_t &x) {
+    uint8_t b[2];
+    if (!byte(b[0])) return false;
+    if (b[0] < 0x80) {
+      x = b[0];
+      return true;
+    }
+    if (!byte(b[1]) || (b[1] == 0x80)) return false;
+    p -= 2;
+    return vlv(x);
+  }
+
+  // decode a track into notes, or count its note-ons into scan
+  bool read_track(SMF_NOTES *notes, SMF_SCAN *scan) {
+    uint32_t chunk_size;
+    // like midifile, ignore the chunk size and read up to the end of track
+    if (!tag("MTrk") || !be32(chunk_size)) return false;
+
+    // unreleased note-ons, linked through pending, by channel and key
+    int top[16 * 128];
+    fill(begin(top), end(top), -1);
+
+    long long tick = 0;
+    uint8_t running = 0;
+    while (true) {
+      uint32_t delta;
+      if (!vlv(delta)) return false;
+      tick += delta;
+      if (tick > INT_MAX) return false;
+
+      uint8_t status, data[2];
+      if (!byte(status)) return false;
+      bool is_running = (status < 0x80);
+      if (is_running) {
+        if ((running == 0) || (running >= 0xf0)) return false;
+        data[0] = status;
+        status = running;
+      }
+      else {
+        running = status;
+      }
+
+      switch (status & 0xf0) {
+        case 0x80:
+        case 0x90:
+        case 0xa0:
+        case 0xb0:
+        case 0xe0:
+          if (!is_running && !byte(data[0])) return false;
+          if (!byte(data[1])) return false;
+          if ((data[0] > 0x7f) || (data[1] > 0x7f)) return false;
+          if (scan) {
+            if ((status & 0xf0) == 0x90 && (data[1] > 0)) {
+              scan->note_ons[status & 0x0f]++;
+              scan->onsets.push_back((int)tick);
+            }
+          }
+          else if ((status & 0xf0) == 0x90 && (data[1] > 0)) {
+            SMF_NOTES &out = *notes;
+            int key = ((status & 0x0f) << 7) | data[0];
+            pending.push_back(top[key]);
+            top[key] = out.size();
+            out.pitch.push_back(data[0]);
+            out.onset.push_back((int)tick);
+            out.duration.push_back(0);
+            out.velocity.push_back(data[1]);
+          }
+          else if ((status & 0xf0) <= 0x90) {
+            SMF_NOTES &out = *notes;
+            int key = ((status & 0x0f) << 7) | data[0];
+            int note = top[key];
+            if (note >= 0) {
+              top[key] = pending[note];
+              out.duration[note] = (int)tick - out.onset[note];
+            }
+          }
+          break;
+        case 0xc0:
+        case 0xd0:
+          if (!is_running && (!byte(data[0]) || (data[0] > 0x7f))) return false;
+          break;
+        default: {
+          uint32_t length;
+          if (status == 0xff) {
+            uint8_t type;
+            if (!byte(type) || !meta_length(length) || !skip(length)) return false;
+            if (type == 0x2f) return true; // end of track
+          }
+          else if ((status == 0xf0) || (status == 0xf7)) {
+            if (!vlv(length) || !skip(length)) return false;
+          }
+          else {
+            return false;
+          }
+        }
+      }
+    }
+  }
+};
+
+// an input stream over a buffer, which reads it in place
+class MEMORY_STREAMBUF : public streambuf {
+public:
+  MEMORY_STREAMBUF(const uint8_t *data, size_t size) {
+    char *p = (char*)data;
+    setg(p, p, p + size);
+  }
+};
+
+// the notes of a midifile that has been read, paired by linkNotePairs
+void midifile_notes(smf::MidiFile &midifile, SMF_NOTES &out) {
+  {
+    PROFILE_SCOPE scope(STAGE_LINK_NOTE_PAIRS);
+    midifile.linkNotePairs();
+  }
+  out.track_count = midifile.getTrackCount();
+  out.ticks = midifile.getTicksPerQuarterNote();
+  for (int track=0; track<out.track_count; track++) {
+    for (int event=0; event<midifile[track].size(); event++) {
+      if (midifile[track][event].isNoteOn()) {
+        out.pitch.push_back((int)midifile[track][event][1]);
+        out.onset.push_back(midifile[track][event].tick);
+        out.duration.push_back(midifile[track][event].getTickDuration());
+        out.velocity.push_back((int)midifile[track][event][2]);
+      }
+    }
+  }
+}
+
+// the notes as read by smf::MidiFile and paired by linkNotePairs
+void read_midifile_notes(const string &filepath, SMF_NOTES &out) {
+  out.clear();
+  smf::MidiFile midifile;
+  {
+    PROFILE_SCOPE scope(STAGE_MIDIFILE_READ);
+    QUIET_CALL(midifile.read(filepath));
+  }
+  midifile_notes(midifile, out);
+}
+
+// the same, for a file held in memory
+void read_midifile_notes(const uint8_t *data, size_t size, SMF_NOTES &out) {
+  out.clear();
+  smf::MidiFile midifile;
+  {
+    PROFILE_SCOPE scope(STAGE_MIDIFILE_READ);
+    MEMORY_STREAMBUF buffer(data, size);
+    istream input(&buffer);
+    QUIET_CALL(midifile.read(input));
+  }
+  midifile_notes(midifile, out);
+}
+
+// decode the file in place, and use smf::MidiFile for anything else.
+// returns false if the fallback was used.
+bool read_smf_notes(const string &filepath, SMF_NOTES &out) {
+  PROFILE_SCOPE scope(STAGE_READ);
+  {
+    MAPPED_FILE file(filepath);
+    SMF_READER reader;
+    if (file.data && reader(file.data, file.size, out)) {
+      return true;
+    }
+  }
+  read_midifile_notes(filepath, out);
+  return false;
+}
+
+// the same, for a file held in memory
+bool read_smf_notes(const uint8_t *data, size_t size, SMF_NOTES &out) {
+  PROFILE_SCOPE scope(STAGE_READ);
+  SMF_READER reader;
+  if (reader(data, size, out)) {
+    return true;
+  }
+  read_midifile_notes(data, size, out);
+  return false;
+}
+
+#endif
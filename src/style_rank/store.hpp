@@ -0,0 +1,416 @@
+#ifndef STYLE_RANK_STORE_H
+#define STYLE_RANK_STORE_H
+
+#include "utils.hpp"
+#include "smf.hpp"
+#include "cache.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <unordered_map>
+#include <stdint.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// an append-only store of the distributions of each featurized piece, so
+// that a file is only featurized again once it changes. records are keyed
+// by path, modification time, size and the parse parameters, and the last
+// record of a key wins. the log is read through a memory map and records
+// are appended with a single write under an exclusive flock on a separate
+// lock file, so any number of processes can read while others append.
+// compaction rewrites the live records to a new log and renames it over
+// the old one, which readers notice by its inode on their next refresh.
+
+static const uint32_t FEATURE_STORE_VERSION = 1;
+static const char *FEATURE_STORE_LOG = "/features.log";
+static const char *FEATURE_STORE_LOCK = "/features.lock";
+
+struct FEATURE_RECORD_HEADER {
+  char magic[4];
+  uint32_t version;
+  uint64_t length; // of the whole record, a multiple of 8
+  uint64_t checksum; // of the payload
+  uint64_t header_checksum; // of the fields below
+  int64_t mtime;
+  uint64_t file_size;
+  int32_t resolution;
+  int32_t include_offsets;
+  int32_t valid; // 0 if the piece had too few chords to be featurized
+  uint32_t path_length;
+  uint32_t n_features;
+  uint32_t padding;
+};
+
+// each feature of a record, after the path: the name, then n keys and n
+// counts
+struct FEATURE_RECORD_ENTRY {
+  uint32_t name_length;
+  uint32_t n;
+};
+
+class FEATURE_STORE_STATS {
+public:
+  atomic<uint64_t> hits{0};
+  atomic<uint64_t> misses{0};
+  atomic<uint64_t> appends{0};
+  atomic<uint64_t> records{0}; // live keys, as of the last refresh
+  atomic<long long> bytes{0}; // of the log, as of the last refresh or append
+};
+
+class FEATURE_STORE {
+public:
+  string dir;
+  FEATURE_STORE_STATS stats;
+
+  FEATURE_STORE(const string &_dir) {
+    dir = _dir;
+    if (dir.empty()) {
+      throw invalid_argument("feature store directory must not be empty");
+    }
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+      throw runtime_error("cannot open feature store directory " + dir);
+    }
+    closedir(d);
+    refresh();
+  }
+
+  // map the log again and index the records appended (by any process)
+  // since the last refresh. call before a batch of get().
+  void refresh() {
+    lock_guard<mutex> guard(index_lock);
+    struct stat st;
+    if (stat(log_path().c_str(), &st) != 0) {
+      log.reset();
+      index.clear();
+      scanned = 0;
+      inode = 0;
+      stats.records = 0;
+      stats.bytes = 0;
+      return;
+    }
+    if ((uint64_t)st.st_ino != inode) {
+      index.clear();
+      scanned = 0;
+      inode = st.st_ino;
+    }
+    log = make_shared<MAPPED_FILE>(log_path());
+    scanned = scan(log->data, log->size, scanned, index);
+    stats.records = index.size();
+    stats.bytes = log->size;
+  }
+
+  // the stored distributions of feature_names for path, if every one of
+  // them is stored for the current version of the file. valid is false
+  // (and dists empty) if the piece had too few chords.
+  bool get(const string &path, int resolution, bool include_offsets, const vector<string> &feature_names, bool &valid, vector<unique_ptr<DISCRETE_DIST>> &dists) {
+    PROFILE_SCOPE scope(STAGE_STORE_GET);
+    int64_t mtime;
+    uint64_t size;
+    map<string,unique_ptr<DISCRETE_DIST>> found;
+    if (!file_version(path, mtime, size) ||
+      !read_record(record_key(path, mtime, size, resolution, include_offsets), valid, found)) {
+      stats.misses++;
+      return false;
+    }
+    dists.clear();
+    if (valid) {
+      for (const auto &name : feature_names) {
+        auto it = found.find(name);
+        if (it == found.end()) {
+          dists.clear();
+          stats.misses++;
+          return false;
+        }
+        dists.push_back(move(it->second));
+      }
+    }
+    stats.hits++;
+    scope.count(1);
+    return true;
+  }
+
+  // append the distributions of feature_names for path. features stored
+  // for the same version of the file by an earlier record are kept.
+  void put(const string &path, int resolution, bool include_offsets, const vector<string> &feature_names, bool valid, const vector<unique_ptr<DISCRETE_DIST>> &dists) {
+    PROFILE_SCOPE scope(STAGE_STORE_PUT);
+    int64_t mtime;
+    uint64_t size;
+    if (!file_version(path, mtime, size)) return;
+    map<string,unique_ptr<DISCRETE_DIST>> merged;
+    bool was_valid;
+    read_record(record_key(path, mtime, size, resolution, include_offsets), was_valid, merged);
+    if (valid) {
+      for (size_t k=0; k<feature_names.size(); k++) {
+        merged[feature_names[k]].reset(new DISCRETE_DIST(*dists[k]));
+      }
+    }
+    else {
+      merged.clear();
+    }
+    vector<char> buf;
+    encode(path, mtime, size, resolution, include_offsets, valid, merged, buf);
+    if (append(buf)) {
+      stats.appends++;
+    }
+  }
+
+  // rewrite the log with only the last record of each key whose file
+  // still has the same modification time and size. returns the number of
+  // bytes removed.
+  long long compact() {
+    int lock = lock_file();
+    if (lock < 0) {
+      throw runtime_error("cannot lock feature store " + dir);
+    }
+    long long removed = 0;
+    try {
+      MAPPED_FILE current(log_path());
+      unordered_map<string,size_t> live;
+      scan(current.data, current.size, 0, live);
+      vector<size_t> offsets;
+      for (const auto &kv : live) {
+        const auto *h = (const FEATURE_RECORD_HEADER*)(current.data + kv.second);
+        string path((const char*)(h + 1), h->path_length);
+        int64_t mtime;
+        uint64_t size;
+        if (file_version(path, mtime, size) && (mtime == h->mtime) && (size == h->file_size) &&
+          valid_payload(current.data + kv.second)) {
+          offsets.push_back(kv.second);
+        }
+      }
+      sort(offsets.begin(), offsets.end()); // keep the log order
+      string tmp = log_path() + ".tmp." + to_string(getpid());
+      FILE *f = fopen(tmp.c_str(), "wb");
+      if (!f) {
+        throw runtime_error("cannot write " + tmp);
+      }
+      long long kept = 0;
+      bool written = true;
+      for (auto offset : offsets) {
+        const auto *h = (const FEATURE_RECORD_HEADER*)(current.data + offset);
+        written &= (fwrite(current.data + offset, 1, h->length, f) == h->length);
+        kept += h->length;
+      }
+      written &= (fflush(f) == 0) && (fsync(fileno(f)) == 0);
+      written &= (fclose(f) == 0);
+      if (!written || (rename(tmp.c_str(), log_path().c_str()) != 0)) {
+        remove(tmp.c_str());
+        throw runtime_error("cannot compact feature store " + dir);
+      }
+      removed = (long long)current.size - kept;
+    }
+    catch (...) {
+      unlock_file(lock);
+      throw;
+    }
+    unlock_file(lock);
+    refresh();
+    return removed;
+  }
+
+private:
+  mutex index_lock;
+  mutex append_lock;
+  shared_ptr<MAPPED_FILE> log; // kept alive by readers across a refresh
+  uint64_t inode = 0;
+  size_t scanned = 0;
+  unordered_map<string,size_t> index; // the offset of the last record of each key
+
+  string log_path() const { return dir + FEATURE_STORE_LOG; }
+  string lock_path() const { return dir + FEATURE_STORE_LOCK; }
+
+  static size_t aligned(size_t n) {
+    return (n + 7) & ~(size_t)7;
+  }
+
+  static bool file_version(const string &path, int64_t &mtime, uint64_t &size) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+#ifdef __APPLE__
+    mtime = (int64_t)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    size = st.st_size;
+    return true;
+  }
+
+  static string record_key(const string &path, int64_t mtime, uint64_t size, int resolution, bool include_offsets) {
+    string key = path;
+    key.push_back('\0');
+    key.append((const char*)&mtime, sizeof(mtime));
+    key.append((const char*)&size, sizeof(size));
+    key.append((const char*)&resolution, sizeof(resolution));
+    key.push_back(include_offsets);
+    return key;
+  }
+
+  static uint64_t header_hash(const FEATURE_RECORD_HEADER &h) {
+    const size_t start = offsetof(FEATURE_RECORD_HEADER, mtime);
+    return content_hash((const uint8_t*)&h + start, sizeof(h) - start) ^ mix64(h.length);
+  }
+
+  // index the complete records in data[offset,size), resyncing on the next
+  // record boundary after a damaged header. returns the offset to resume
+  // from, which is before any record that is still being written. a record
+  // torn by a crashed writer fails its checksum when it is read, so it
+  // (and any record it swallowed) is featurized and appended again.
+  static size_t scan(const uint8_t *data, size_t size, size_t offset, unordered_map<string,size_t> &out) {
+    while (offset + sizeof(FEATURE_RECORD_HEADER) <= size) {
+      FEATURE_RECORD_HEADER h;
+      memcpy(&h, data + offset, sizeof(h));
+      if ((memcmp(h.magic, "SRFR", 4) != 0) || (h.version != FEATURE_STORE_VERSION) ||
+        (h.header_checksum != header_hash(h)) || (h.length % 8) ||
+        (h.length < sizeof(h) + aligned(h.path_length))) {
+        offset += 8;
+        continue;
+      }
+      if (offset + h.length > size) break; // not yet complete
+      string path((const char*)data + offset + sizeof(h), h.path_length);
+      out[record_key(path, h.mtime, h.file_size, h.resolution, h.include_offsets)] = offset;
+      offset += h.length;
+    }
+    return min(offset, size);
+  }
+
+  static bool valid_payload(const uint8_t *record) {
+    const auto *h = (const FEATURE_RECORD_HEADER*)record;
+    return content_hash(record + sizeof(*h), h->length - sizeof(*h)) == h->checksum;
+  }
+
+  bool read_record(const string &key, bool &valid, map<string,unique_ptr<DISCRETE_DIST>> &out) {
+    shared_ptr<MAPPED_FILE> mapped;
+    size_t offset;
+    {
+      lock_guard<mutex> guard(index_lock);
+      auto it = index.find(key);
+      if ((it == index.end()) || !log) return false;
+      mapped = log;
+      offset = it->second;
+    }
+    const uint8_t *record = mapped->data + offset;
+    if (!valid_payload(record)) return false;
+    const auto *h = (const FEATURE_RECORD_HEADER*)record;
+    const uint8_t *p = record + sizeof(*h) + aligned(h->path_length);
+    const uint8_t *e = record + h->length;
+    valid = h->valid;
+    out.clear();
+    for (uint32_t k=0; k<h->n_features; k++) {
+      FEATURE_RECORD_ENTRY entry;
+      if ((size_t)(e - p) < sizeof(entry)) return false;
+      memcpy(&entry, p, sizeof(entry));
+      p += sizeof(entry);
+      size_t bytes = aligned(entry.name_length) + 2 * sizeof(uint64_t) * (size_t)entry.n;
+      if ((size_t)(e - p) < bytes) return false;
+      string name((const char*)p, entry.name_length);
+      p += aligned(entry.name_length);
+      unique_ptr<DISCRETE_DIST> dist = sparse_dist();
+      for (uint32_t i=0; i<entry.n; i++) {
+        uint64_t kv[2];
+        memcpy(&kv[0], p + i * sizeof(uint64_t), sizeof(uint64_t));
+        memcpy(&kv[1], p + (entry.n + i) * sizeof(uint64_t), sizeof(uint64_t));
+        (*dist)[kv[0]] = kv[1];
+      }
+      p += 2 * sizeof(uint64_t) * (size_t)entry.n;
+      out[name] = move(dist);
+    }
+    return true;
+  }
+
+  static void put_bytes(vector<char> &buf, const void *data, size_t n) {
+    size_t offset = buf.size();
+    buf.resize(aligned(offset + n), 0);
+    if (n) memcpy(buf.data() + offset, data, n);
+  }
+
+  static void encode(const string &path, int64_t mtime, uint64_t size, int resolution, bool include_offsets, bool valid, const map<string,unique_ptr<DISCRETE_DIST>> &dists, vector<char> &buf) {
+    FEATURE_RECORD_HEADER h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "SRFR", 4);
+    h.version = FEATURE_STORE_VERSION;
+    h.mtime = mtime;
+    h.file_size = size;
+    h.resolution = resolution;
+    h.include_offsets = include_offsets;
+    h.valid = valid;
+    h.path_length = path.size();
+    h.n_features = dists.size();
+
+    buf.assign(sizeof(h), 0);
+    put_bytes(buf, path.data(), path.size());
+    vector<uint64_t> keys, counts;
+    for (const auto &kv : dists) {
+      keys.clear();
+      counts.clear();
+      for (const auto &x : *kv.second) {
+        keys.push_back(x.first);
+        counts.push_back(x.second);
+      }
+      FEATURE_RECORD_ENTRY entry = {(uint32_t)kv.first.size(), (uint32_t)keys.size()};
+      put_bytes(buf, &entry, sizeof(entry));
+      put_bytes(buf, kv.first.data(), kv.first.size());
+      put_bytes(buf, keys.data(), keys.size() * sizeof(uint64_t));
+      put_bytes(buf, counts.data(), counts.size() * sizeof(uint64_t));
+    }
+    h.length = buf.size();
+    h.checksum = content_hash((const uint8_t*)buf.data() + sizeof(h), buf.size() - sizeof(h));
+    h.header_checksum = header_hash(h);
+    memcpy(buf.data(), &h, sizeof(h));
+  }
+
+  int lock_file() const {
+    int fd = open(lock_path().c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return -1;
+    if (flock(fd, LOCK_EX) != 0) {
+      close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  static void unlock_file(int fd) {
+    flock(fd, LOCK_UN);
+    close(fd);
+  }
+
+  // a single write of the whole record at the end of the log
+  bool append(const vector<char> &buf) {
+    lock_guard<mutex> guard(append_lock);
+    int lock = lock_file();
+    if (lock < 0) return false;
+    int fd = open(log_path().c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+    bool written = false;
+    if (fd >= 0) {
+      size_t done = 0;
+      while (done < buf.size()) {
+        ssize_t n = write(fd, buf.data() + done, buf.size() - done);
+        if (n <= 0) break;
+        done += n;
+      }
+      written = (done == buf.size());
+      struct stat st;
+      if (fstat(fd, &st) == 0) stats.bytes = st.st_size;
+      close(fd);
+    }
+    unlock_file(lock);
+    return written;
+  }
+};
+
+#endif
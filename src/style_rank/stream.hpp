@@ -0,0 +1,344 @@
+#ifndef STYLE_RANK_STREAM_H
+#define STYLE_RANK_STREAM_H
+
+#include "utils.hpp"
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <stdint.h>
+
+using namespace std;
+
+// a space-saving heavy hitter sketch (Metwally et al. 2005) with at most
+// capacity counters. every key counted more than total()/capacity times is
+// monitored, and the count of a monitored key overestimates its true count
+// by at most its error. the counters are kept in a min-heap so the smallest
+// one can be replaced in O(log capacity).
+class SPACE_SAVING {
+public:
+  struct COUNTER {
+    uint64_t key;
+    uint64_t count; // an upper bound on the true count
+    uint64_t error; // count - error is a lower bound on the true count
+  };
+
+  SPACE_SAVING(size_t _capacity) : capacity(_capacity) {
+    if (capacity == 0) {
+      throw invalid_argument("a sketch needs at least one counter");
+    }
+  }
+
+  void add(uint64_t key, uint64_t weight=1) {
+    n += weight;
+    auto it = pos.find(key);
+    if (it != pos.end()) {
+      heap[it->second].count += weight;
+      sift_down(it->second);
+    }
+    else if (heap.size() < capacity) {
+      pos[key] = heap.size();
+      heap.push_back({key, weight, 0});
+      sift_up(heap.size() - 1);
+    }
+    else {
+      evictions++;
+      pos.erase(heap[0].key);
+      pos[key] = 0;
+      heap[0] = {key, heap[0].count + weight, heap[0].count};
+      sift_down(0);
+    }
+  }
+
+  // combine with a sketch of another stream (Agarwal et al. 2012). a key
+  // missing from a full sketch may have been counted up to its minimum.
+  void merge(const SPACE_SAVING &o) {
+    uint64_t a = floor(), b = o.floor();
+    unordered_map<uint64_t,COUNTER> both;
+    for (const auto &c : heap) {
+      both[c.key] = {c.key, c.count + b, c.error + b};
+    }
+    for (const auto &c : o.heap) {
+      auto it = both.find(c.key);
+      if (it != both.end()) {
+        it->second.count += c.count - b;
+        it->second.error += c.error - b;
+      }
+      else {
+        both[c.key] = {c.key, c.count + a, c.error + a};
+      }
+    }
+    vector<COUNTER> merged;
+    for (const auto &kv : both) {
+      merged.push_back(kv.second);
+    }
+    sort(merged.begin(), merged.end(), by_count);
+    if (merged.size() > capacity) {
+      evictions += merged.size() - capacity;
+      merged.resize(capacity);
+    }
+    evictions += o.evictions;
+    n += o.n;
+    heap.clear();
+    pos.clear();
+    for (const auto &c : merged) {
+      pos[c.key] = heap.size();
+      heap.push_back(c);
+      sift_up(heap.size() - 1);
+    }
+  }
+
+  // the estimated count of every monitored key
+  map<uint64_t,size_t> counts() const {
+    map<uint64_t,size_t> ret;
+    for (const auto &c : heap) {
+      ret[c.key] = c.count;
+    }
+    return ret;
+  }
+
+  const vector<COUNTER> &counters() const { return heap; }
+
+  // an upper bound on the count of any key that is not monitored
+  uint64_t floor() const {
+    return (heap.size() < capacity) ? 0 : heap[0].count;
+  }
+
+  uint64_t total() const { return n; }
+  size_t size() const { return heap.size(); }
+  size_t evicted() const { return evictions; }
+
+private:
+  size_t capacity;
+  uint64_t n = 0;
+  size_t evictions = 0;
+  vector<COUNTER> heap;
+  unordered_map<uint64_t,size_t> pos; // the heap index of each key
+
+  static bool by_count(const COUNTER &a, const COUNTER &b) {
+    return (a.count != b.count) ? (a.count > b.count) : (a.key > b.key);
+  }
+
+  void swap_nodes(size_t i, size_t j) {
+    swap(heap[i], heap[j]);
+    pos[heap[i].key] = i;
+    pos[heap[j].key] = j;
+  }
+  void sift_up(size_t i) {
+    while ((i > 0) && (heap[i].count < heap[(i - 1) / 2].count)) {
+      swap_nodes(i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+  }
+  void sift_down(size_t i) {
+    while (true) {
+      size_t smallest = i;
+      for (size_t c=2*i+1; (c<=2*i+2) && (c<heap.size()); c++) {
+        if (heap[c].count < heap[smallest].count) smallest = c;
+      }
+      if (smallest == i) return;
+      swap_nodes(i, smallest);
+      i = smallest;
+    }
+  }
+};
+
+// how far a streamed domain may be from the one Collector would choose
+class DOMAIN_REPORT {
+public:
+  size_t rows = 0; // pieces seen
+  uint64_t updates = 0; // (piece, key) pairs counted by the sketch
+  size_t evictions = 0; // 0 means every count is exact
+  size_t domain_size = 0;
+  uint64_t max_error = 0; // the largest overestimate of a domain count
+  size_t guaranteed = 0; // domain values that are certainly in the exact top k
+};
+
+// a Collector that keeps memory bounded regardless of the number of pieces.
+// the domain of each feature is chosen with a space-saving sketch of the
+// number of pieces containing each value, and each distribution is spooled
+// to a temporary file as a compact (key, count) record, from which the
+// fixed-width rows are written in a second pass once the domain is known.
+// the rows are exact counts over the chosen domain. the domain itself is
+// exact as long as no counter was evicted, and otherwise may swap values
+// whose piece counts are within max_error of each other.
+class STREAM_COLLECTOR {
+public:
+  STREAM_COLLECTOR(size_t _capacity) : capacity(_capacity) {
+    if (capacity == 0) {
+      throw invalid_argument("sketch_size must be positive");
+    }
+  }
+
+  void add(string name, unique_ptr<DISCRETE_DIST> x) {
+    auto it = features.find(name);
+    if (it == features.end()) {
+      it = features.emplace(name, unique_ptr<FEATURE>(new FEATURE(capacity))).first;
+    }
+    FEATURE &f = *it->second;
+    keys.clear();
+    counts.clear();
+    for (const auto &kv : *x) {
+      f.sketch.add(kv.first);
+      keys.push_back(kv.first);
+      counts.push_back(kv.second);
+    }
+    uint32_t n = keys.size();
+    if ((fwrite(&n, sizeof(n), 1, f.spool.get()) != 1) ||
+      (fwrite(keys.data(), sizeof(uint64_t), n, f.spool.get()) != n) ||
+      (fwrite(counts.data(), sizeof(uint64_t), n, f.spool.get()) != n)) {
+      throw runtime_error("failed to spool the distributions of " + name);
+    }
+    f.rows++;
+  }
+
+  vector<string> names() const {
+    vector<string> ret;
+    for (const auto &kv : features) {
+      ret.push_back(kv.first);
+    }
+    return ret;
+  }
+  size_t rows(const string &name) {
+    return feature(name).rows;
+  }
+
+  // the (at most upper_bound) values of a feature with the largest
+  // estimated piece counts, ranked the way Collector ranks exact counts
+  vector<uint64_t> getDomain(const string &name, size_t upper_bound) {
+    return top_domain(feature(name).sketch.counts(), upper_bound);
+  }
+
+  // the same layout as Collector::getMatrix, read back from the spool
+  template<typename T>
+  void getMatrix(const string &name, const vector<uint64_t> &domain, T *mat) {
+    size_t width = domain.size() + 1;
+    fill(mat, mat + rows(name) * width, 0);
+    readRows(name, domain, [&](vector<pair<int32_t,uint64_t>> &row) {
+      for (const auto &x : row) {
+        mat[x.first] = saturate_cast<T>(x.second);
+      }
+      mat += width;
+    });
+  }
+
+  // the same counts as getMatrix, without the zeros
+  template<typename T>
+  void getCSR(const string &name, const vector<uint64_t> &domain, CSR_MATRIX<T> &csr) {
+    readRows(name, domain, [&](vector<pair<int32_t,uint64_t>> &row) {
+      csr.addRow(row);
+    });
+  }
+
+  tuple<VECTOR_MAP,VECTOR_MAP> getData(size_t upper_bound) {
+    VECTOR_MAP ret, domains;
+    for (const auto &name : names()) {
+      auto domain = getDomain(name, upper_bound);
+      vector<uint64_t> mat(rows(name) * (domain.size() + 1));
+      getMatrix(name, domain, mat.data());
+      domains[name] = domain;
+      ret[name] = mat;
+    }
+    return make_pair(ret, domains);
+  }
+
+  // the error bounds of the domain getDomain(name, upper_bound) returns
+  DOMAIN_REPORT report(const string &name, size_t upper_bound) {
+    FEATURE &f = feature(name);
+    DOMAIN_REPORT r;
+    r.rows = f.rows;
+    r.updates = f.sketch.total();
+    r.evictions = f.sketch.evicted();
+    auto domain = getDomain(name, upper_bound);
+    unordered_set<uint64_t> chosen(domain.begin(), domain.end());
+    // anything outside the domain was counted at most this many times
+    uint64_t outside = f.sketch.floor();
+    for (const auto &c : f.sketch.counters()) {
+      if (!chosen.count(c.key)) {
+        outside = max(outside, c.count);
+      }
+    }
+    r.domain_size = domain.size();
+    for (const auto &c : f.sketch.counters()) {
+      if (chosen.count(c.key)) {
+        r.max_error = max(r.max_error, c.error);
+        r.guaranteed += (c.count - c.error >= outside);
+      }
+    }
+    return r;
+  }
+
+private:
+  struct FEATURE {
+    SPACE_SAVING sketch;
+    unique_ptr<FILE,int(*)(FILE*)> spool;
+    size_t rows = 0;
+
+    FEATURE(size_t capacity) : sketch(capacity), spool(tmpfile(), fclose) {
+      if (!spool) {
+        throw runtime_error("failed to create a temporary file");
+      }
+    }
+  };
+
+  size_t capacity;
+  map<string,unique_ptr<FEATURE>> features;
+  vector<uint64_t> keys, counts; // scratch for one record
+
+  FEATURE &feature(const string &name) {
+    auto it = features.find(name);
+    if (it == features.end()) {
+      throw invalid_argument(name + " was not collected");
+    }
+    return *it->second;
+  }
+
+  // call f with each spooled row as (column, count) pairs over domain,
+  // with the remainder in column domain.size()
+  template<typename F>
+  void readRows(const string &name, const vector<uint64_t> &domain, F f) {
+    FEATURE &feat = feature(name);
+    unordered_map<uint64_t,int32_t> column;
+    for (size_t i=0; i<domain.size(); i++) {
+      column[domain[i]] = i;
+    }
+    vector<pair<int32_t,uint64_t>> row;
+    fflush(feat.spool.get());
+    rewind(feat.spool.get());
+    for (size_t r=0; r<feat.rows; r++) {
+      uint32_t n;
+      if (fread(&n, sizeof(n), 1, feat.spool.get()) != 1) {
+        throw runtime_error("failed to read the distributions of " + name);
+      }
+      keys.resize(n);
+      counts.resize(n);
+      if ((fread(keys.data(), sizeof(uint64_t), n, feat.spool.get()) != n) ||
+        (fread(counts.data(), sizeof(uint64_t), n, feat.spool.get()) != n)) {
+        throw runtime_error("failed to read the distributions of " + name);
+      }
+      row.clear();
+      uint64_t remain = 0;
+      for (uint32_t i=0; i<n; i++) {
+        auto it = column.find(keys[i]);
+        if (it != column.end()) {
+          row.push_back(make_pair(it->second, counts[i]));
+        }
+        else {
+          remain += counts[i];
+        }
+      }
+      row.push_back(make_pair((int32_t)domain.size(), remain)); // add remainder
+      f(row);
+    }
+    fseek(feat.spool.get(), 0, SEEK_END);
+  }
+};
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef STYLE_RANK_THREAD_POOL_H
+#define STYLE_RANK_THREAD_POOL_H
+
+#include "profile.hpp"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+using namespace std;
+
+// resolve the number of workers to use for n tasks.
+// num_threads <= 0 means use every available core.
+int resolve_num_threads(int num_threads, size_t n) {
+  if (num_threads <= 0) {
+    num_threads = (int)thread::hardware_concurrency();
+  }
+  if (num_threads <= 0) num_threads = 1;
+  return (int)max<size_t>(1, min<size_t>((size_t)num_threads, n));
+}
+
+// a contiguous block of task indices owned by a single worker.
+// the owner takes work from the front and thieves take it from the back,
+// so the owner keeps walking neighbouring indices for as long as possible.
+class TASK_RANGE {
+public:
+  mutex lock;
+  size_t begin = 0;
+  size_t end = 0;
+
+  bool pop_front(size_t &index) {
+    lock_guard<mutex> guard(lock);
+    if (begin >= end) return false;
+    index = begin++;
+    return true;
+  }
+  bool steal_back(size_t &index) {
+    lock_guard<mutex> guard(lock);
+    if (begin >= end) return false;
+    index = --end;
+    return true;
+  }
+  size_t remaining() {
+    lock_guard<mutex> guard(lock);
+    return end - begin;
+  }
+};
+
+// run f(index, worker) for every index in [0,n) on num_threads workers.
+// indices are split into one block per worker and idle workers steal from
+// the worker with the most remaining tasks, since task cost (e.g. midi file
+// size) can vary by several orders of magnitude. the first exception thrown
+// by any task is rethrown on the calling thread once all workers are joined.
+template <typename F>
+void parallel_for(size_t n, int num_threads, F f) {
+  if (n == 0) return;
+  int workers = resolve_num_threads(num_threads, n);
+  if (workers == 1) {
+    for (size_t i=0; i<n; i++) {
+      f(i, 0);
+    }
+    return;
+  }
+
+  vector<TASK_RANGE> ranges(workers);
+  for (int w=0; w<workers; w++) {
+    ranges[w].begin = n * w / workers;
+    ranges[w].end = n * (w + 1) / workers;
+  }
+
+  atomic<bool> failed(false);
+  exception_ptr error = nullptr;
+  mutex error_lock;
+
+  auto steal = [&](int self, size_t &index) {
+    while (true) {
+      int victim = -1;
+      size_t most = 0;
+      for (int w=0; w<workers; w++) {
+        if (w == self) continue;
+        size_t rem = ranges[w].remaining();
+        if (rem > most) {
+          most = rem;
+          victim = w;
+        }
+      }
+      if (victim < 0) return false;
+      if (ranges[victim].steal_back(index)) return true;
+    }
+  };
+
+  bool profiled = thread_profiled;
+  auto run = [&](int self) {
+    thread_profiled = profiled;
+    size_t index;
+    while (!failed.load(memory_order_relaxed)) {
+      if (!ranges[self].pop_front(index) && !steal(self, index)) break;
+      try {
+        f(index, self);
+      }
+      catch (...) {
+        lock_guard<mutex> guard(error_lock);
+        if (!error) error = current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  vector<thread> threads;
+  for (int w=1; w<workers; w++) {
+    threads.emplace_back(run, w);
+  }
+  run(0);
+  for (auto &t : threads) {
+    t.join();
+  }
+  if (error) rethrow_exception(error);
+}
+
+#endif
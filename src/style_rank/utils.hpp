@@ -2,6 +2,8 @@
 #define STYLE_RANK_UTILS_H
 
 #include <memory>
+#include <new>
+#include <iterator>
 #include <vector>
 #include <numeric>
 #include <sstream>
@@ -11,15 +13,41 @@
 #include <map>
 #include <unordered_map>
 #include <algorithm>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
 #include <assert.h>
 
+#include "profile.hpp"
+
+// suppresses std::cout and std::cerr while in scope. scopes nest, so a
+// caller can silence the streams once around a parallel section and the
+// nested scopes opened by worker threads never touch the stream state.
+class QUIET_SCOPE {
+public:
+    QUIET_SCOPE() {
+        std::lock_guard<std::mutex> guard(lock());
+        if (depth()++ == 0) {
+            std::cout.setstate(std::ios_base::failbit);
+            std::cerr.setstate(std::ios_base::failbit);
+        }
+    }
+    ~QUIET_SCOPE() {
+        std::lock_guard<std::mutex> guard(lock());
+        if (--depth() == 0) {
+            std::cout.clear();
+            std::cerr.clear();
+        }
+    }
+private:
+    static std::mutex &lock() { static std::mutex m; return m; }
+    static int &depth() { static int d = 0; return d; }
+};
+
 // macro for suppressing std::cout and std::cerr
 #define QUIET_CALL(noisy) { \
-    std::cout.setstate(std::ios_base::failbit);\
-    std::cerr.setstate(std::ios_base::failbit);\
+    QUIET_SCOPE quiet_scope;\
     (noisy);\
-    std::cout.clear();\
-    std::cerr.clear();\
 }
 
 int mod(int a, int b) {
@@ -56,7 +84,193 @@ public:
   }
 };
 
-using DISCRETE_DIST = std::unordered_map<uint64_t, uint64_t>;
+// the largest domain that is counted in a flat array
+static const size_t MAX_DENSE_DOMAIN = 1024;
+
+// a histogram over uint64_t keys. keys below dense_size are counted in a
+// flat array and any other key goes to a flat open-addressing table, so a
+// distribution costs a couple of allocations rather than one per key.
+// keys with a count of zero are treated as absent.
+class DISCRETE_DIST {
+public:
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<const uint64_t,uint64_t> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type *pointer;
+        typedef const value_type &reference;
+
+        const_iterator() : d(nullptr), pos(0), cur(0, 0) {}
+        const_iterator(const DISCRETE_DIST *_d, size_t _pos) : d(_d), pos(_pos), cur(0, 0) {
+            settle();
+        }
+        const_iterator(const const_iterator &o) = default;
+        const_iterator& operator=(const const_iterator &o) {
+            d = o.d;
+            pos = o.pos;
+            load(o.cur.first, o.cur.second);
+            return *this;
+        }
+        const_iterator& operator++() {
+            pos++;
+            settle();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator ret(*this);
+            ++*this;
+            return ret;
+        }
+        bool operator!=(const const_iterator &o) const { return pos != o.pos; }
+        bool operator==(const const_iterator &o) const { return pos == o.pos; }
+        reference operator*() const { return cur; }
+        pointer operator->() const { return &cur; }
+    private:
+        const DISCRETE_DIST *d;
+        size_t pos; // indexes the dense array, then the table slots
+        value_type cur;
+
+        // the key of cur is const, as in a map, so it is rebuilt in place
+        void load(uint64_t key, uint64_t value) {
+            cur.~value_type();
+            new (&cur) value_type(key, value);
+        }
+
+        void settle() {
+            size_t nd = d->dense.size();
+            size_t end = nd + d->values.size();
+            while ((pos < end) && (d->value_at(pos) == 0)) {
+                pos++;
+            }
+            if (pos < end) {
+                if (pos < nd) {
+                    load(pos, d->dense[pos]);
+                }
+                else {
+                    load(d->keys[pos - nd], d->values[pos - nd]);
+                }
+            }
+        }
+    };
+
+    DISCRETE_DIST(size_t dense_size=0) : dense(dense_size, 0) {}
+
+    uint64_t &operator[](uint64_t key) {
+        if (key < dense.size()) {
+            return dense[key];
+        }
+        if ((used + 1) * 2 > values.size()) {
+            grow();
+        }
+        size_t slot = probe(key);
+        if (!occupied[slot]) {
+            occupied[slot] = 1;
+            keys[slot] = key;
+            used++;
+        }
+        return values[slot];
+    }
+
+    const_iterator find(uint64_t key) const {
+        if (key < dense.size()) {
+            return dense[key] ? const_iterator(this, key) : end();
+        }
+        if (values.empty()) {
+            return end();
+        }
+        size_t slot = probe(key);
+        if (occupied[slot] && values[slot]) {
+            return const_iterator(this, dense.size() + slot);
+        }
+        return end();
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, dense.size() + values.size()); }
+
+    size_t size() const {
+        size_t n = 0;
+        for (auto it = begin(); it != end(); ++it) n++;
+        return n;
+    }
+
+    bool operator==(const DISCRETE_DIST &o) const {
+        if (size() != o.size()) return false;
+        for (const auto &kv : *this) {
+            auto it = o.find(kv.first);
+            if ((it == o.end()) || (it->second != kv.second)) return false;
+        }
+        return true;
+    }
+
+private:
+    std::vector<uint64_t> dense;
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> values;
+    std::vector<char> occupied;
+    size_t used = 0;
+
+    uint64_t value_at(size_t pos) const {
+        return (pos < dense.size()) ? dense[pos] : values[pos - dense.size()];
+    }
+
+    static size_t hash(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return (size_t)key;
+    }
+
+    // the slot holding key, or the empty slot where it belongs
+    size_t probe(uint64_t key) const {
+        size_t mask = values.size() - 1;
+        size_t slot = hash(key) & mask;
+        while (occupied[slot] && (keys[slot] != key)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void grow() {
+        std::vector<uint64_t> old_keys, old_values;
+        std::vector<char> old_occupied;
+        old_keys.swap(keys);
+        old_values.swap(values);
+        old_occupied.swap(occupied);
+        size_t capacity = old_values.empty() ? 16 : old_values.size() * 2;
+        keys.resize(capacity);
+        values.resize(capacity, 0);
+        occupied.resize(capacity, 0);
+        for (size_t i=0; i<old_values.size(); i++) {
+            if (old_occupied[i]) {
+                size_t slot = probe(old_keys[i]);
+                occupied[slot] = 1;
+                keys[slot] = old_keys[i];
+                values[slot] = old_values[i];
+            }
+        }
+    }
+};
+
+// features declare the kind of their domain when they create their
+// distribution. bounded domains are counted in a flat array ...
+template <size_t N>
+std::unique_ptr<DISCRETE_DIST> dense_dist() {
+    static_assert(N <= MAX_DENSE_DOMAIN, "domain is too large to be dense");
+    return std::unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST(N)};
+}
+
+// ... unless the bound depends on the piece and turns out to be large ...
+std::unique_ptr<DISCRETE_DIST> dense_dist(size_t n) {
+    return std::unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST(n <= MAX_DENSE_DOMAIN ? n : 0)};
+}
+
+// ... and sparse domains only use the open-addressing table.
+std::unique_ptr<DISCRETE_DIST> sparse_dist() {
+    return std::unique_ptr<DISCRETE_DIST>{new DISCRETE_DIST};
+}
+
 using VECTOR_MAP = std::map<std::string, std::vector<uint64_t>>;
 
 template<typename TK, typename TV>
@@ -108,6 +322,54 @@ void print(std::unordered_map<TK,TV> const& src) {
     std::cout << std::endl;
 }
 
+// the (at most upper_bound) values with the largest counts, largest first
+std::vector<uint64_t> top_domain(const std::map<uint64_t,size_t> &counts, size_t upper_bound) {
+    auto rev_domains = flip_map(counts);
+    auto domain = extract_values_in_reverse<size_t,uint64_t>(rev_domains);
+    if (domain.size() > upper_bound) {
+        domain.resize(upper_bound); // only keep top n
+    }
+    return domain;
+}
+
+// convert a count to T, saturating if it does not fit
+template<typename T>
+T saturate_cast(uint64_t x) {
+    if (std::numeric_limits<T>::is_integer && (x > (uint64_t)std::numeric_limits<T>::max())) {
+        return std::numeric_limits<T>::max();
+    }
+    return (T)x;
+}
+
+// a compressed sparse row matrix, laid out the way scipy.sparse.csr_matrix
+// stores one (with 32 bit indices)
+template<typename T>
+class CSR_MATRIX {
+public:
+    std::vector<int32_t> indptr = {0};
+    std::vector<int32_t> indices;
+    std::vector<T> data;
+
+    // append a row from (column, count) pairs in any order. zero counts
+    // are left out.
+    void addRow(std::vector<std::pair<int32_t,uint64_t>> &row) {
+        std::sort(row.begin(), row.end());
+        for (const auto &x : row) {
+            if (x.second) {
+                indices.push_back(x.first);
+                data.push_back(saturate_cast<T>(x.second));
+            }
+        }
+        if (indices.size() > (size_t)std::numeric_limits<int32_t>::max()) {
+            throw std::overflow_error("too many non-zero values for a CSR matrix");
+        }
+        indptr.push_back(indices.size());
+    }
+    size_t rows() const {
+        return indptr.size() - 1;
+    }
+};
+
 class Collector {
 public:
     std::vector<int> labels;
@@ -123,40 +385,91 @@ public:
     void addLabel(int label) {
         labels.push_back(label);
     }
+
+    // the features that have been added, and the number of rows of each
+    std::vector<std::string> names() const {
+        std::vector<std::string> ret;
+        for (const auto &kv : dists) {
+            ret.push_back(kv.first);
+        }
+        return ret;
+    }
+    size_t rows(const std::string &name) {
+        return dists[name].size();
+    }
  
+    // the (at most upper_bound) most frequent values of a feature, most
+    // frequent first
+    std::vector<uint64_t> getDomain(const std::string &name, size_t upper_bound) {
+        return top_domain(domains_map[name], upper_bound);
+    }
+
+    // write the counts of each distribution of a feature over domain, plus
+    // the remainder, as rows of a (dists[name].size(),domain.size()+1)
+    // row-major matrix. counts that do not fit in T saturate.
+    template<typename T>
+    void getMatrix(const std::string &name, const std::vector<uint64_t> &domain, T *mat) {
+        for (const auto &dist : dists[name]) {
+
+            // find the total of the distribution
+            auto total = std::accumulate(
+                dist->begin(), dist->end(), (size_t)0, [](const size_t s, const auto &elem) { return s + elem.second; });
+            
+            // find the keys in the distribution
+            size_t used = 0;
+            for (const auto &d : domain) {
+                auto it = dist->find( d );
+                if (it != dist->end()) {
+                    *mat++ = saturate_cast<T>(it->second);
+                    used += it->second;
+                }
+                else {
+                    *mat++ = 0; // if not found in distribution
+                }
+            }
+            *mat++ = saturate_cast<T>(total - used); // add remainder 
+        }
+    }
+
+    // the same counts as getMatrix, without the zeros
+    template<typename T>
+    void getCSR(const std::string &name, const std::vector<uint64_t> &domain, CSR_MATRIX<T> &csr) {
+        std::unordered_map<uint64_t,int32_t> column;
+        for (size_t i=0; i<domain.size(); i++) {
+            column[domain[i]] = i;
+        }
+        std::vector<std::pair<int32_t,uint64_t>> row;
+        for (const auto &dist : dists[name]) {
+            row.clear();
+            uint64_t remain = 0;
+            for (const auto &kv : *dist) {
+                auto it = column.find(kv.first);
+                if (it != column.end()) {
+                    row.push_back(std::make_pair(it->second, kv.second));
+                }
+                else {
+                    remain += kv.second;
+                }
+            }
+            row.push_back(std::make_pair((int32_t)domain.size(), remain)); // add remainder
+            csr.addRow(row);
+        }
+    }
+
     std::tuple<VECTOR_MAP,VECTOR_MAP> getData(size_t upper_bound) {
         
         VECTOR_MAP ret;
         VECTOR_MAP domains;
 
         for (auto const &kv : dists) {
-            auto rev_domains = flip_map(domains_map[kv.first]);
-            auto domain = extract_values_in_reverse<size_t,uint64_t>(rev_domains);
-            if (domain.size() > upper_bound) {
-                domain.resize(upper_bound); // only keep top n
-            }
-            std::vector<uint64_t> mat;
-
-            for (const auto &dist : kv.second) {
-
-                // find the total of the distribution
-                auto total = std::accumulate(
-                    dist->begin(), dist->end(), 0, [](const size_t s, const auto &elem) { return s + elem.second; });
-                
-                // find the keys in the distribution
-                size_t used = 0;
-                for (const auto &d : domain) {
-                    auto it = dist->find( d );
-                    if (it != dist->end()) {
-                        mat.push_back(it->second);
-                        used += it->second;
-                    }
-                    else {
-                        mat.push_back(0); // if not found in distribution
-                    }
-                }
-                mat.push_back(total - used); // add remainder 
+            std::vector<uint64_t> domain;
+            {
+                PROFILE_SCOPE scope(STAGE_DOMAINS);
+                domain = getDomain(kv.first, upper_bound);
             }
+            std::vector<uint64_t> mat(kv.second.size() * (domain.size() + 1));
+            PROFILE_SCOPE scope(STAGE_MATRIX);
+            getMatrix(kv.first, domain, mat.data());
             domains[kv.first] = domain;
             ret[kv.first] = mat;  
         }
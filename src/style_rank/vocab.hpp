@@ -0,0 +1,125 @@
+#ifndef STYLE_RANK_VOCAB_H
+#define STYLE_RANK_VOCAB_H
+
+#include "utils.hpp"
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <algorithm>
+#include <stdint.h>
+
+using namespace std;
+
+// a Collector for a frozen vocabulary. each distribution is projected onto
+// the fixed domain of its feature as soon as it is added, so new pieces
+// get the same columns as the corpus the vocabulary was built from without
+// recounting it, and no distribution is kept once its row is written.
+class VOCAB_COLLECTOR {
+public:
+  VOCAB_COLLECTOR(const VECTOR_MAP &vocabulary) {
+    for (const auto &kv : vocabulary) {
+      FEATURE &f = features[kv.first];
+      f.domain = kv.second;
+      for (size_t i=0; i<f.domain.size(); i++) {
+        if (!f.column.insert(make_pair(f.domain[i], i)).second) {
+          throw invalid_argument("the domain of " + kv.first + " has duplicate values");
+        }
+      }
+    }
+  }
+
+  bool contains(const string &name) const {
+    return features.find(name) != features.end();
+  }
+
+  void add(string name, unique_ptr<DISCRETE_DIST> x) {
+    FEATURE &f = feature(name);
+    size_t width = f.domain.size() + 1;
+    f.mat.resize(f.mat.size() + width, 0);
+    uint64_t *row = f.mat.data() + f.rows * width;
+    for (const auto &kv : *x) {
+      auto it = f.column.find(kv.first);
+      row[(it != f.column.end()) ? it->second : f.domain.size()] += kv.second;
+    }
+    f.rows++;
+  }
+
+  // the features that have been added, and the number of rows of each
+  vector<string> names() const {
+    vector<string> ret;
+    for (const auto &kv : features) {
+      if (kv.second.rows) ret.push_back(kv.first);
+    }
+    return ret;
+  }
+  size_t rows(const string &name) {
+    return feature(name).rows;
+  }
+
+  // the frozen domain, whatever upper_bound is
+  vector<uint64_t> getDomain(const string &name, size_t) {
+    return feature(name).domain;
+  }
+
+  // the same layout as Collector::getMatrix. domain must be the frozen one.
+  template<typename T>
+  void getMatrix(const string &name, const vector<uint64_t> &domain, T *mat) {
+    FEATURE &f = feature(name);
+    if (domain != f.domain) {
+      throw invalid_argument("the domain of " + name + " is frozen");
+    }
+    transform(f.mat.begin(), f.mat.end(), mat, saturate_cast<T>);
+  }
+
+  // the same counts as getMatrix, without the zeros
+  template<typename T>
+  void getCSR(const string &name, const vector<uint64_t> &domain, CSR_MATRIX<T> &csr) {
+    FEATURE &f = feature(name);
+    if (domain != f.domain) {
+      throw invalid_argument("the domain of " + name + " is frozen");
+    }
+    size_t width = domain.size() + 1;
+    vector<pair<int32_t,uint64_t>> row;
+    for (size_t r=0; r<f.rows; r++) {
+      row.clear();
+      for (size_t j=0; j<width; j++) {
+        row.push_back(make_pair((int32_t)j, f.mat[r * width + j]));
+      }
+      csr.addRow(row);
+    }
+  }
+
+  tuple<VECTOR_MAP,VECTOR_MAP> getData(size_t) {
+    VECTOR_MAP ret, domains;
+    for (const auto &name : names()) {
+      domains[name] = feature(name).domain;
+      ret[name] = feature(name).mat;
+    }
+    return make_pair(ret, domains);
+  }
+
+private:
+  struct FEATURE {
+    vector<uint64_t> domain;
+    unordered_map<uint64_t,size_t> column;
+    vector<uint64_t> mat; // (rows,domain.size()+1) row-major
+    size_t rows = 0;
+  };
+
+  map<string,FEATURE> features;
+
+  FEATURE &feature(const string &name) {
+    auto it = features.find(name);
+    if (it == features.end()) {
+      throw invalid_argument(name + " is not in the vocabulary");
+    }
+    return it->second;
+  }
+};
+
+#endif
@@ -0,0 +1,121 @@
+// benchmark chord segmentation on pedal-tone heavy pieces.
+//
+// a single held note makes the largest note duration span the whole piece,
+// which turned the previous multimap based segmentation (a scan of every
+// note ending in (s, s+max_duration] at each boundary) into O(n^2). the
+// previous algorithm is kept here as a reference, and every run checks that
+// Piece::findChords produces identical chords.
+//
+// g++ -O2 -o bench_chords -I../src/style_rank bench_chords.cpp ../src/style_rank/deps/*.cpp -std=c++14 -pthread
+// ./bench_chords [n_notes] [n_pedals]
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "../src/style_rank/parse.hpp"
+
+using namespace std;
+
+// a segment as (onset, duration, note indices sorted by pitch)
+typedef tuple<int,int,vector<int>> SEGMENT;
+
+// the segmentation used before the sweep line
+void reference_chords(Piece *p, bool include_offsets, vector<SEGMENT> &chords, vector<SEGMENT> &chords_w_rests) {
+  multimap<int,int> etree;
+  int max_duration = 0;
+  for (int k=0; k<(int)p->notes.size(); k++) {
+    etree.insert( make_pair(p->notes.end[k], k) );
+    max_duration = max(max_duration, p->notes.duration[k]);
+  }
+  vector<int> bounds;
+  if (include_offsets) {
+    bounds = p->onsets_and_offsets;
+  }
+  else {
+    bounds = p->onsets;
+    bounds.push_back(p->onsets_and_offsets.back());
+  }
+  for (int i=0; i<(int)bounds.size() - 1; i++) {
+    int s = bounds[i];
+    vector<int> notes;
+    auto itend = etree.upper_bound(s+max_duration);
+    for (auto it = etree.upper_bound(s); it != itend; it++) {
+      if (p->notes.onset[it->second] <= s) {
+        notes.push_back(it->second);
+      }
+    }
+    sort(notes.begin(), notes.end(), [p](int a, int b){
+      return p->notes.pitch[a] < p->notes.pitch[b];});
+    auto chord = SEGMENT(s, bounds[i+1] - s, notes);
+    if (!notes.empty()) {
+      chords.push_back( chord );
+    }
+    else {
+      chords_w_rests.push_back( chord );
+    }
+  }
+}
+
+// a melody over n_pedals notes held for the whole piece, with a few short
+// rests so both chord lists are exercised
+vector<array<int,3>> pedal_piece(int n_notes, int n_pedals, int seed) {
+  mt19937 rng(seed);
+  uniform_int_distribution<int> pitch(48, 84), dur(1, 4), rest(0, 15);
+  vector<array<int,3>> notes;
+  int t = 0;
+  for (int i=0; i<n_notes; i++) {
+    int d = dur(rng);
+    notes.push_back({pitch(rng), t, d});
+    t += d + (rest(rng) == 0);
+  }
+  for (int i=0; i<n_pedals; i++) {
+    notes.push_back({36 + 7*i, 0, t});
+  }
+  return notes;
+}
+
+bool same_chords(const vector<CHORD> &a, const vector<SEGMENT> &b) {
+  if (a.size() != b.size()) return false;
+  for (int i=0; i<(int)a.size(); i++) {
+    const vector<int> &notes = get<2>(b[i]);
+    if ((a[i].onset != get<0>(b[i])) || (a[i].duration != get<1>(b[i]))) return false;
+    if (!equal(a[i].note, a[i].note + a[i].size, notes.begin(), notes.end())) return false;
+  }
+  return true;
+}
+
+template <typename F>
+double time_ms(F f) {
+  auto start = chrono::steady_clock::now();
+  f();
+  return chrono::duration<double,milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+  int max_notes = argc > 1 ? atoi(argv[1]) : 32000;
+  int n_pedals = argc > 2 ? atoi(argv[2]) : 2;
+  printf("%8s %8s %8s %12s %12s %8s\n", "notes", "pedals", "offsets", "sweep ms", "multimap ms", "speedup");
+  for (int n=1000; n<=max_notes; n*=2) {
+    for (int include_offsets=0; include_offsets<2; include_offsets++) {
+      auto notes = pedal_piece(n, n_pedals, n);
+      Piece sweep(notes, include_offsets);
+      sweep.chords.clear();
+      sweep.chords_w_rests.clear();
+      sweep.chord_notes.clear();
+      sweep.chord_pitches.clear();
+      sweep.chord_onsets.clear();
+      double sweep_ms = time_ms([&](){ sweep.findChords(include_offsets); });
+
+      vector<SEGMENT> chords, chords_w_rests;
+      double ref_ms = time_ms([&](){
+        reference_chords(&sweep, include_offsets, chords, chords_w_rests); });
+
+      if (!same_chords(sweep.chords, chords) ||
+        !same_chords(sweep.chords_w_rests, chords_w_rests)) {
+        printf("MISMATCH at %d notes (include_offsets=%d)\n", n, include_offsets);
+        return 1;
+      }
+      printf("%8d %8d %8d %12.2f %12.2f %7.1fx\n", n, n_pedals, include_offsets, sweep_ms, ref_ms, ref_ms / sweep_ms);
+    }
+  }
+  return 0;
+}
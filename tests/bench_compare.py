@@ -0,0 +1,45 @@
+# compare two result files written by bench_suite.
+#
+# each benchmark present in both files is listed with its median time in
+# each run and the ratio new/old. runs are only comparable if they used
+# the same generator config, so a differing config is reported first.
+# exits with status 1 if any benchmark is slower than --threshold.
+#
+# python bench_compare.py old.json new.json [--threshold 1.1]
+import sys
+import json
+import argparse
+
+if __name__ == "__main__":
+  parser = argparse.ArgumentParser()
+  parser.add_argument("old")
+  parser.add_argument("new")
+  parser.add_argument("--threshold", type=float, default=1.1)
+  args = parser.parse_args()
+
+  with open(args.old) as f:
+    old = json.load(f)
+  with open(args.new) as f:
+    new = json.load(f)
+
+  for k in sorted(set(old["config"]) | set(new["config"])):
+    if old["config"].get(k) != new["config"].get(k):
+      print("config {} differs: {} vs {}".format(k, old["config"].get(k), new["config"].get(k)))
+
+  old_results = {r["name"] : r for r in old["results"]}
+  regressions = 0
+  print("{:40s} {:>12s} {:>12s} {:>8s}".format("benchmark", "old ms", "new ms", "ratio"))
+  for r in new["results"]:
+    if r["name"] not in old_results:
+      continue
+    a = old_results[r["name"]]["median_ns"] / 1e6
+    b = r["median_ns"] / 1e6
+    ratio = b / a if a > 0 else float("inf")
+    flag = ""
+    if ratio > args.threshold:
+      flag = " slower"
+      regressions += 1
+    elif ratio < 1. / args.threshold:
+      flag = " faster"
+    print("{:40s} {:12.3f} {:12.3f} {:8.2f}{}".format(r["name"], a, b, ratio, flag))
+  sys.exit(1 if regressions else 0)
@@ -0,0 +1,74 @@
+# benchmark the native random forest against sklearn's RandomForestClassifier
+# on synthetic count features shaped like the output of get_features.
+#
+# the two forests use different random streams, so they are compared
+# statistically: the style scores (summed leaf similarity to the style set)
+# of the rank set should correlate with sklearn about as well as two sklearn
+# forests with different seeds correlate with each other.
+import time
+import argparse
+import numpy as np
+from scipy.stats import spearmanr
+from sklearn.ensemble import RandomForestClassifier
+
+from style_rank.api import rf_leaves
+
+def synthetic_features(n_rank, n_style, n_features, width, seed):
+  rng = np.random.RandomState(seed)
+  labels = np.array([0] * n_rank + [1] * n_style)
+  features = []
+  for _ in range(n_features):
+    lam = rng.gamma(1., 4., size=(width,))
+    shift = rng.gamma(1., 1., size=(width,)) * (rng.rand(width) < .2)
+    x = rng.poisson(lam, size=(len(labels), width))
+    x[labels==1] += rng.poisson(shift, size=((labels==1).sum(), width))
+    features.append(x)
+  return features, labels
+
+def sklearn_leaves(features, labels, n_estimators, max_depth, seed):
+  leaves = []
+  for feature in features:
+    clf = RandomForestClassifier(n_estimators=n_estimators, max_depth=max_depth, bootstrap=True, criterion='entropy', class_weight='balanced', random_state=seed)
+    clf.fit(feature, labels)
+    leaves.append(clf.apply(feature))
+  return leaves
+
+def style_scores(all_leaves, labels):
+  scores = np.zeros((len(labels),))
+  for leaves in all_leaves:
+    for t in range(leaves.shape[1]):
+      counts = np.bincount(leaves[labels==1,t], minlength=leaves[:,t].max()+1)
+      scores += counts[leaves[:,t]] / leaves.shape[1]
+  return scores[labels==0]
+
+if __name__ == "__main__":
+  parser = argparse.ArgumentParser()
+  parser.add_argument("--n_rank", type=int, default=1000)
+  parser.add_argument("--n_style", type=int, default=1000)
+  parser.add_argument("--n_features", type=int, default=45)
+  parser.add_argument("--width", type=int, default=101)
+  parser.add_argument("--n_estimators", type=int, default=100)
+  parser.add_argument("--max_depth", type=int, default=3)
+  parser.add_argument("--num_threads", type=int, default=0)
+  args = parser.parse_args()
+
+  features, labels = synthetic_features(
+    args.n_rank, args.n_style, args.n_features, args.width, 0)
+
+  start = time.time()
+  sk_a = sklearn_leaves(features, labels, args.n_estimators, args.max_depth, 1)
+  sk_time = time.time() - start
+  sk_b = sklearn_leaves(features, labels, args.n_estimators, args.max_depth, 2)
+
+  start = time.time()
+  native = rf_leaves(features, labels, n_estimators=args.n_estimators, max_depth=args.max_depth, num_threads=args.num_threads, random_state=1)
+  native_time = time.time() - start
+
+  a, b, c = (style_scores(x, labels) for x in (sk_a, sk_b, native))
+  print("sklearn time      : {:.3f}s".format(sk_time))
+  print("native time       : {:.3f}s ({:.1f}x)".format(native_time, sk_time / native_time))
+  print("sklearn vs sklearn: spearman {:.4f}".format(spearmanr(a, b)[0]))
+  print("sklearn vs native : spearman {:.4f}".format(spearmanr(a, c)[0]))
+  print("leaves per tree   : sklearn {:.2f} native {:.2f}".format(
+    np.mean([len(np.unique(l[:,t])) for l in sk_a for t in range(l.shape[1])]),
+    np.mean([len(np.unique(l[:,t])) for l in native for t in range(l.shape[1])])))
@@ -0,0 +1,125 @@
+// compare the streaming collector with the exact one on synthetic pieces.
+//
+// for each sketch size, reports how many of the exact top upper_bound
+// domain values the sketch chose (recall), how many domain values the
+// sketch can guarantee are in the exact domain, the largest overestimate
+// of a piece count, and the peak memory of collecting (each mode runs in
+// its own process, so peak rss is not shared).
+//
+// g++ -O2 -o bench_stream -I../src/style_rank bench_stream.cpp ../src/style_rank/deps/*.cpp -std=c++14 -pthread -lz
+// ./bench_stream [n_pieces] [upper_bound]
+#include <random>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "../src/style_rank/extract.hpp"
+
+using namespace std;
+
+static const vector<string> FEATURES = {
+  "ChordShape", "ChordPCDWBass", "ChordOnsetShape", "IntervalDist"};
+
+// a random walk in pitch over a wide range, so the chord shape domains
+// keep growing with the number of pieces
+vector<array<int,3>> random_piece(int n_notes, int seed) {
+  mt19937 rng(seed);
+  uniform_int_distribution<int> step(-7, 7), voices(1, 6), dur(1, 8), gap(1, 4);
+  vector<array<int,3>> notes;
+  int t = 0, pitch = 60;
+  while ((int)notes.size() < n_notes) {
+    int v = voices(rng), d = dur(rng);
+    for (int i=0; i<v; i++) {
+      pitch = clamp(pitch + step(rng), 21, 108);
+      notes.push_back({pitch, t, d});
+    }
+    t += gap(rng);
+  }
+  return notes;
+}
+
+template <typename COLLECTOR>
+void collect(COLLECTOR &c, int n_pieces) {
+  FusedExtractor extractor(FEATURES);
+  for (int i=0; i<n_pieces; i++) {
+    auto notes = random_piece(200, i);
+    Piece p(notes);
+    auto dists = extractor(&p);
+    for (int k=0; k<(int)FEATURES.size(); k++) {
+      c.add(FEATURES[k], move(dists[k]));
+    }
+  }
+}
+
+long peak_rss_kb() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+// run f in a child process and return its peak rss
+template <typename F>
+long in_child(F f) {
+  int fds[2];
+  if (pipe(fds) != 0) exit(1);
+  pid_t pid = fork();
+  if (pid == 0) {
+    f();
+    long rss = peak_rss_kb();
+    if (write(fds[1], &rss, sizeof(rss)) != sizeof(rss)) _exit(1);
+    _exit(0);
+  }
+  long rss = 0;
+  if (read(fds[0], &rss, sizeof(rss)) != sizeof(rss)) rss = -1;
+  waitpid(pid, nullptr, 0);
+  close(fds[0]);
+  close(fds[1]);
+  return rss;
+}
+
+int main(int argc, char **argv) {
+  int n_pieces = argc > 1 ? atoi(argv[1]) : 5000;
+  size_t upper_bound = argc > 2 ? atoi(argv[2]) : 100;
+
+  long base_rss = in_child([](){});
+  long exact_rss = in_child([&](){
+    Collector c;
+    collect(c, n_pieces);
+    c.getData(upper_bound);
+  });
+  printf("%d pieces, upper_bound=%zu, exact collector peak rss %ld kb\n", n_pieces, upper_bound, exact_rss - base_rss);
+  printf("%16s %8s %8s %10s %10s %10s %10s %10s\n", "feature", "sketch", "domain", "recall", "guaranteed", "max_error", "evictions", "rss kb");
+
+  // measure memory before the parent holds any distributions
+  vector<size_t> sizes = {1, 2, 5, 10, 50};
+  vector<long> rss;
+  for (auto &s : sizes) {
+    s *= upper_bound;
+    rss.push_back(in_child([&](){
+      STREAM_COLLECTOR c(s);
+      collect(c, n_pieces);
+      c.getData(upper_bound);
+    }));
+  }
+
+  Collector exact;
+  collect(exact, n_pieces);
+  for (size_t i=0; i<sizes.size(); i++) {
+    STREAM_COLLECTOR stream(sizes[i]);
+    collect(stream, n_pieces);
+    for (const auto &name : FEATURES) {
+      auto truth = exact.getDomain(name, upper_bound);
+      auto domain = stream.getDomain(name, upper_bound);
+      set<uint64_t> chosen(domain.begin(), domain.end());
+      size_t hits = 0;
+      for (auto key : truth) {
+        hits += chosen.count(key);
+      }
+      auto r = stream.report(name, upper_bound);
+      printf("%16s %8zu %8zu %10.3f %10zu %10lu %10zu %10ld\n", name.c_str(), sizes[i], r.domain_size,
+        truth.empty() ? 1. : (double)hits / truth.size(), r.guaranteed, (unsigned long)r.max_error,
+        r.evictions, rss[i] - base_rss);
+    }
+  }
+  return 0;
+}
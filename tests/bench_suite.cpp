@@ -0,0 +1,323 @@
+// benchmark each stage of the pipeline on a seeded synthetic corpus.
+//
+// pieces are generated from a seed with a configurable note density,
+// polyphony, share of long sustained notes and track count, so two runs
+// with the same options time exactly the same work. the micro benchmarks
+// time parsing, segmentation, every feature function, the fused extractor
+// and Collector::getData separately, and the corpus benchmarks run
+// extract_features end to end over the pieces written as .mid files.
+// results are written as json (compare two runs with bench_compare.py).
+//
+// g++ -O2 -o bench_suite -I../src/style_rank bench_suite.cpp ../src/style_rank/deps/*.cpp -std=c++14 -pthread -lz
+// ./bench_suite [--pieces 50] [--notes 2000] [--density 2] [--polyphony 4]
+//   [--sustain 0.02] [--tracks 4] [--seed 0] [--reps 5] [--threads 0]
+//   [--upper-bound 500] [--filter name] [--corpus dir] [--out results.json]
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include "../src/style_rank/extract.hpp"
+
+using namespace std;
+
+// the generator. times are in ticks.
+class SYNTH_CONFIG {
+public:
+  int pieces = 50;
+  int notes = 2000; // per piece
+  double density = 2.; // onsets per beat
+  int polyphony = 4; // the most notes started at one onset
+  double sustain = .02; // the probability a note is held for 8 to 32 beats
+  int tracks = 4;
+  int ticks = 96; // per beat
+  int seed = 0;
+};
+
+// notes as (pitch, onset, duration). each voice of an onset takes a step
+// of a random walk in pitch, and the gaps between onsets are exponential
+// on a sixteenth note grid.
+vector<array<int,3>> synth_piece(const SYNTH_CONFIG &cfg, int index) {
+  mt19937 rng(cfg.seed * 1000003 + index);
+  uniform_int_distribution<int> voices(1, max(cfg.polyphony, 1)), step(-5, 5), sustained(8, 32);
+  uniform_real_distribution<double> coin(0., 1.);
+  exponential_distribution<double> gap(max(cfg.density, 1e-3));
+  static const int beat_fraction[] = {4, 2, 1, 1, 1, 2, 1, 4}; // in sixteenths
+  int grid = max(cfg.ticks / 4, 1);
+  vector<int> pitch;
+  for (int i=0; i<cfg.polyphony; i++) {
+    pitch.push_back(clamp(72 - 7 * i, 21, 108));
+  }
+  vector<array<int,3>> notes;
+  int t = 0;
+  while ((int)notes.size() < cfg.notes) {
+    int v = voices(rng);
+    for (int i=0; (i<v) && ((int)notes.size()<cfg.notes); i++) {
+      pitch[i] = clamp(pitch[i] + step(rng), 21, 108);
+      int duration = (coin(rng) < cfg.sustain) ?
+        sustained(rng) * cfg.ticks : beat_fraction[rng() % 8] * grid;
+      notes.push_back({pitch[i], t, duration});
+    }
+    t += max(1, (int)round(gap(rng) * 4)) * grid;
+  }
+  return notes;
+}
+
+// write the notes of a piece as a type 1 midi file, with the notes dealt
+// to the tracks in turn
+void write_midi(const string &path, const vector<array<int,3>> &notes, const SYNTH_CONFIG &cfg) {
+  smf::MidiFile midifile;
+  midifile.setTicksPerQuarterNote(cfg.ticks);
+  midifile.addTracks(max(cfg.tracks, 1) - 1);
+  for (int k=0; k<(int)notes.size(); k++) {
+    int track = k % max(cfg.tracks, 1);
+    int channel = (track % 15) + (track % 15 >= 9); // skip the drum channel
+    midifile.addNoteOn(track, notes[k][1], channel, notes[k][0], 80);
+    midifile.addNoteOff(track, notes[k][1] + notes[k][2], channel, notes[k][0]);
+  }
+  midifile.sortTracks();
+  if (!midifile.write(path)) {
+    fprintf(stderr, "failed to write %s\n", path.c_str());
+    exit(1);
+  }
+}
+
+// the timings of one benchmark. items are what one repetition processes
+// (notes, chords, pieces, ...).
+class BENCH_RESULT {
+public:
+  string name;
+  string unit;
+  uint64_t items = 0;
+  vector<double> ns;
+
+  double median() const {
+    vector<double> s = ns;
+    sort(s.begin(), s.end());
+    return s.empty() ? 0. : s[s.size() / 2];
+  }
+  double best() const {
+    return ns.empty() ? 0. : *min_element(ns.begin(), ns.end());
+  }
+  double mean() const {
+    return ns.empty() ? 0. : accumulate(ns.begin(), ns.end(), 0.) / ns.size();
+  }
+};
+
+class BENCH {
+public:
+  int reps = 5;
+  string filter;
+  vector<BENCH_RESULT> results;
+
+  // time f reps times after one untimed run. setup is run before each
+  // repetition and is not timed.
+  template <typename SETUP, typename F>
+  void run(const string &name, const string &unit, uint64_t items, SETUP setup, F f) {
+    if (!filter.empty() && (name.find(filter) == string::npos)) return;
+    BENCH_RESULT r;
+    r.name = name;
+    r.unit = unit;
+    r.items = items;
+    for (int i=0; i<=reps; i++) {
+      setup();
+      auto start = chrono::steady_clock::now();
+      f();
+      double ns = chrono::duration<double,nano>(chrono::steady_clock::now() - start).count();
+      if (i > 0) r.ns.push_back(ns);
+    }
+    fprintf(stderr, "%-40s %12.3f ms %14.0f %s/s\n", name.c_str(), r.median() / 1e6, items / (r.median() / 1e9), unit.c_str());
+    results.push_back(r);
+  }
+  template <typename F>
+  void run(const string &name, const string &unit, uint64_t items, F f) {
+    run(name, unit, items, [](){}, f);
+  }
+
+  void write_json(FILE *f, const SYNTH_CONFIG &cfg, int threads, int upper_bound) const {
+    fprintf(f, "{\n  \"schema\": 1,\n");
+    fprintf(f, "  \"config\": {\"pieces\": %d, \"notes\": %d, \"density\": %g, \"polyphony\": %d, "
+      "\"sustain\": %g, \"tracks\": %d, \"ticks\": %d, \"seed\": %d, \"reps\": %d, \"threads\": %d, "
+      "\"upper_bound\": %d},\n", cfg.pieces, cfg.notes, cfg.density, cfg.polyphony, cfg.sustain,
+      cfg.tracks, cfg.ticks, cfg.seed, reps, threads, upper_bound);
+    fprintf(f, "  \"results\": [");
+    for (size_t i=0; i<results.size(); i++) {
+      const BENCH_RESULT &r = results[i];
+      fprintf(f, "%s\n    {\"name\": \"%s\", \"unit\": \"%s\", \"items\": %llu, \"median_ns\": %.0f, "
+        "\"min_ns\": %.0f, \"mean_ns\": %.0f, \"items_per_sec\": %.1f, \"ns\": [",
+        i ? "," : "", r.name.c_str(), r.unit.c_str(), (unsigned long long)r.items,
+        r.median(), r.best(), r.mean(), r.median() > 0 ? r.items / (r.median() / 1e9) : 0.);
+      for (size_t j=0; j<r.ns.size(); j++) {
+        fprintf(f, "%s%.0f", j ? ", " : "", r.ns[j]);
+      }
+      fprintf(f, "]}");
+    }
+    fprintf(f, "\n  ]\n}\n");
+  }
+};
+
+// the pieces built straight from their notes, and their totals
+class CORPUS {
+public:
+  vector<vector<array<int,3>>> notes;
+  vector<unique_ptr<Piece>> pieces;
+  uint64_t n_notes = 0;
+  uint64_t n_chords = 0;
+
+  CORPUS(const SYNTH_CONFIG &cfg) {
+    for (int i=0; i<cfg.pieces; i++) {
+      notes.push_back(synth_piece(cfg, i));
+      pieces.push_back(unique_ptr<Piece>(new Piece(notes.back())));
+      n_notes += notes.back().size();
+      n_chords += pieces.back()->chords.size();
+    }
+  }
+};
+
+void clear_chords(Piece *p) {
+  p->chords.clear();
+  p->chords_w_rests.clear();
+  p->chord_notes.clear();
+  p->chord_pitches.clear();
+  p->chord_onsets.clear();
+}
+
+int main(int argc, char **argv) {
+  SYNTH_CONFIG cfg;
+  BENCH bench;
+  int threads = 0;
+  int upper_bound = 500;
+  string corpus_dir, out_path;
+  for (int i=1; i+1<argc; i+=2) {
+    string opt = argv[i];
+    const char *val = argv[i+1];
+    if (opt == "--pieces") cfg.pieces = atoi(val);
+    else if (opt == "--notes") cfg.notes = atoi(val);
+    else if (opt == "--density") cfg.density = atof(val);
+    else if (opt == "--polyphony") cfg.polyphony = atoi(val);
+    else if (opt == "--sustain") cfg.sustain = atof(val);
+    else if (opt == "--tracks") cfg.tracks = atoi(val);
+    else if (opt == "--seed") cfg.seed = atoi(val);
+    else if (opt == "--reps") bench.reps = atoi(val);
+    else if (opt == "--threads") threads = atoi(val);
+    else if (opt == "--upper-bound") upper_bound = atoi(val);
+    else if (opt == "--filter") bench.filter = val;
+    else if (opt == "--corpus") corpus_dir = val;
+    else if (opt == "--out") out_path = val;
+    else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+  if ((cfg.pieces < 1) || (cfg.notes < 1) || (cfg.polyphony < 1) || (cfg.tracks < 1) || (bench.reps < 1)) {
+    fprintf(stderr, "pieces, notes, polyphony, tracks and reps must be positive\n");
+    return 1;
+  }
+
+  CORPUS corpus(cfg);
+  vector<string> feature_names = feature_tag_map["ALL"];
+
+  // write the corpus, to a temporary directory unless one is given
+  bool remove_corpus = corpus_dir.empty();
+  if (remove_corpus) {
+    char dir[] = "/tmp/style_rank_benchXXXXXX";
+    if (!mkdtemp(dir)) {
+      fprintf(stderr, "failed to create a temporary directory\n");
+      return 1;
+    }
+    corpus_dir = dir;
+  }
+  vector<string> paths;
+  for (int i=0; i<cfg.pieces; i++) {
+    char name[32];
+    snprintf(name, sizeof(name), "/synth_%05d.mid", i);
+    paths.push_back(corpus_dir + name);
+    write_midi(paths.back(), corpus.notes[i], cfg);
+  }
+
+  bench.run("generate", "notes", corpus.n_notes, [&](){
+    for (int i=0; i<cfg.pieces; i++) synth_piece(cfg, i);
+  });
+
+  // parsing, without segmentation
+  bench.run("parse/read_smf_notes", "notes", corpus.n_notes, [&](){
+    SMF_NOTES smf;
+    for (const auto &path : paths) read_smf_notes(path, smf);
+  });
+  bench.run("parse/midifile", "notes", corpus.n_notes, [&](){
+    SMF_NOTES smf;
+    for (const auto &path : paths) read_midifile_notes(path, smf);
+  });
+  bench.run("parse/piece", "notes", corpus.n_notes, [&](){
+    for (const auto &path : paths) Piece p(path, 0, false, true);
+  });
+  bench.run("piece/from_notes", "notes", corpus.n_notes, [&](){
+    for (auto &notes : corpus.notes) Piece p(notes);
+  });
+
+  // segmentation alone, on pieces whose notes are already in place
+  for (int include_offsets=0; include_offsets<2; include_offsets++) {
+    uint64_t n_chords = 0;
+    for (auto &p : corpus.pieces) {
+      clear_chords(p.get());
+      p->findChords(include_offsets);
+      n_chords += p->chords.size();
+    }
+    bench.run(include_offsets ? "segment/findChords_offsets" : "segment/findChords", "chords", n_chords,
+      [&](){ for (auto &p : corpus.pieces) clear_chords(p.get()); },
+      [&](){ for (auto &p : corpus.pieces) p->findChords(include_offsets); });
+  }
+  for (auto &p : corpus.pieces) {
+    clear_chords(p.get());
+    p->findChords(false);
+  }
+
+  // each feature on its own, and all of them fused
+  for (const auto &name : feature_names) {
+    auto feature = m.at(name);
+    bench.run("feature/" + name, "chords", corpus.n_chords, [&](){
+      for (auto &p : corpus.pieces) feature(p.get());
+    });
+  }
+  FusedExtractor extractor(feature_names);
+  bench.run("features/fused", "chords", corpus.n_chords, [&](){
+    for (auto &p : corpus.pieces) extractor(p.get());
+  });
+
+  // the matrices of every feature, from distributions already collected
+  Collector c;
+  for (auto &p : corpus.pieces) {
+    auto dists = extractor(p.get());
+    for (size_t k=0; k<feature_names.size(); k++) {
+      c.add(feature_names[k], move(dists[k]));
+    }
+  }
+  bench.run("collector/getData", "pieces", cfg.pieces, [&](){
+    c.getData(upper_bound);
+  });
+
+  // end to end over the midi files
+  bench.run("corpus/extract_features", "pieces", cfg.pieces, [&](){
+    Collector c;
+    extract_features(c, paths, feature_names, 0, false, threads);
+  });
+  bench.run("corpus/extract_features_getData", "pieces", cfg.pieces, [&](){
+    Collector c;
+    extract_features(c, paths, feature_names, 0, false, threads);
+    c.getData(upper_bound);
+  });
+
+  if (remove_corpus) {
+    for (const auto &path : paths) unlink(path.c_str());
+    rmdir(corpus_dir.c_str());
+  }
+
+  FILE *f = out_path.empty() ? stdout : fopen(out_path.c_str(), "w");
+  if (!f) {
+    fprintf(stderr, "failed to open %s\n", out_path.c_str());
+    return 1;
+  }
+  bench.write_json(f, cfg, threads, upper_bound);
+  if (f != stdout) fclose(f);
+  return 0;
+}
@@ -2,10 +2,22 @@
 #include "catch.h"
 #include <vector>
 #include <array>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <sys/wait.h>
 #include "../src/style_rank/parse.hpp"
 #include "../src/style_rank/features.hpp"
 #include "../src/style_rank/feature_map.hpp"
 #include "../src/style_rank/utils.hpp"
+#include "../src/style_rank/extract.hpp"
+#include "../src/style_rank/forest.hpp"
+#include "../src/style_rank/fused.hpp"
+#include "../src/style_rank/cache.hpp"
+#include "../src/style_rank/stream.hpp"
+#include "../src/style_rank/vocab.hpp"
+#include "../src/style_rank/store.hpp"
+#include "../src/style_rank/profile.hpp"
 
 /*
 -##-----
@@ -40,12 +52,12 @@ TEST_CASE("SIMPLE_MIDI_PARSE")
     REQUIRE(p->max_duration == 4); // max duration is 4
 
     // check the chord sizes are correct
-    REQUIRE(p->chords[0].notes.size() == 2);
-    REQUIRE(p->chords[1].notes.size() == 3);
-    REQUIRE(p->chords[2].notes.size() == 2);
-    REQUIRE(p->chords[3].notes.size() == 2);
-    REQUIRE(p->chords[4].notes.size() == 2);
-    REQUIRE(p->chords[5].notes.size() == 3);
+    REQUIRE(p->chords[0].size == 2);
+    REQUIRE(p->chords[1].size == 3);
+    REQUIRE(p->chords[2].size == 2);
+    REQUIRE(p->chords[3].size == 2);
+    REQUIRE(p->chords[4].size == 2);
+    REQUIRE(p->chords[5].size == 3);
 
     // check the durations are correct
     REQUIRE(p->chords[0].duration == 1);
@@ -121,10 +133,10 @@ TEST_CASE("CHORD_PCD")
 {
     Piece *p = new Piece(example_notes);
     auto D = m["ChordPCD"](p);
-    REQUIRE((*D)[pcd[std::stoi("001000000001", nullptr, 2)]] == 1);
-    REQUIRE((*D)[pcd[std::stoi("001000010001", nullptr, 2)]] == 4);
-    REQUIRE((*D)[pcd[std::stoi("001000000100", nullptr, 2)]] == 2);
-    REQUIRE((*D)[pcd[std::stoi("000001000100", nullptr, 2)]] == 1);
+    REQUIRE((*D)[pc_sets[std::stoi("001000000001", nullptr, 2)].pcd] == 1);
+    REQUIRE((*D)[pc_sets[std::stoi("001000010001", nullptr, 2)].pcd] == 4);
+    REQUIRE((*D)[pc_sets[std::stoi("001000000100", nullptr, 2)].pcd] == 2);
+    REQUIRE((*D)[pc_sets[std::stoi("000001000100", nullptr, 2)].pcd] == 1);
 
     delete p;
 }
@@ -143,11 +155,11 @@ TEST_CASE("CHORD_SHAPE")
 {
     Piece *p = new Piece(example_notes);
     auto D = m["ChordShape"](p);
-    REQUIRE((*D)[pcd[std::stoi("1001", nullptr, 2)]] == 1);
-    REQUIRE((*D)[pcd[std::stoi("10001001", nullptr, 2)]] == 2);
-    REQUIRE((*D)[pcd[std::stoi("10000001", nullptr, 2)]] == 2);
-    REQUIRE((*D)[pcd[std::stoi("1000000001", nullptr, 2)]] == 1);
-    REQUIRE((*D)[pcd[std::stoi("100100001", nullptr, 2)]] == 2);
+    REQUIRE((*D)[pc_sets[std::stoi("1001", nullptr, 2)].pcd] == 1);
+    REQUIRE((*D)[pc_sets[std::stoi("10001001", nullptr, 2)].pcd] == 2);
+    REQUIRE((*D)[pc_sets[std::stoi("10000001", nullptr, 2)].pcd] == 2);
+    REQUIRE((*D)[pc_sets[std::stoi("1000000001", nullptr, 2)].pcd] == 1);
+    REQUIRE((*D)[pc_sets[std::stoi("100100001", nullptr, 2)].pcd] == 2);
 
     delete p;
 }
@@ -187,6 +199,37 @@ TEST_CASE("CHORD_LOWEST_INTERVAL")
     delete p;
 }
 
+TEST_CASE("CHORD_SUMMARY")
+{
+    Piece *p = new Piece(example_notes);
+    REQUIRE(p->summaries.size() == p->chords.size());
+    const CHORD_SUMMARY &a = p->summaries[0];
+    REQUIRE(a.pc == ((1 << 9) | (1 << 0)));
+    REQUIRE(a.onset_pc == a.pc);
+    REQUIRE(a.tie_pc == 0);
+    REQUIRE(a.bass == 57);
+    REQUIRE(a.second == 60);
+    REQUIRE(a.top == 60);
+    REQUIRE(a.range() == 3);
+    const CHORD_SUMMARY &b = p->summaries[1];
+    REQUIRE(b.onset_pc == (1 << 4));
+    REQUIRE(b.tie_pc == ((1 << 9) | (1 << 0)));
+    REQUIRE(b.size == 3);
+    REQUIRE(b.onset_count == 1);
+    REQUIRE(!b.bass_onset);
+    REQUIRE(b.top_onset);
+    REQUIRE(b.duration == 2);
+    REQUIRE(b.onset == 1);
+    for (int i=0; i<(int)p->chords.size(); i++) {
+        const CHORD &chord = p->chords[i];
+        REQUIRE(p->summaries[i].pc == PCINT(chord).value);
+        REQUIRE(p->summaries[i].onset_pc == PCINT(chord, ONSET_NOTES).value);
+        REQUIRE(p->summaries[i].tie_pc == PCINT(chord, TIE_NOTES).value);
+    }
+
+    delete p;
+}
+
 TEST_CASE("CHORD_TRAN_VOICE_MOTION")
 {
     Piece *p = new Piece(example_notes);
@@ -246,7 +289,1019 @@ TEST_CASE("INTERVAL_DIST")
     delete p;
 }
 
+TEST_CASE("PARALLEL_EXTRACT_IS_DETERMINISTIC")
+{
+    std::vector<std::string> paths = {
+        "bwv2.6.mid", "corrupt.mid", "bwv3.6.mid", "bwv2.6.mid", "bwv3.6.mid"};
+    auto feature_names = feature_tag_map["ALL"];
+
+    Collector serial;
+    auto serial_indices = extract_features(serial, paths, feature_names, 0, false, 1);
+    auto serial_data = serial.getData(100);
+
+    Collector parallel;
+    auto parallel_indices = extract_features(parallel, paths, feature_names, 0, false, 4);
+    auto parallel_data = parallel.getData(100);
+
+    REQUIRE(serial_indices == std::vector<int>({0,2,3,4}));
+    REQUIRE(parallel_indices == serial_indices);
+    REQUIRE(std::get<0>(parallel_data) == std::get<0>(serial_data));
+    REQUIRE(std::get<1>(parallel_data) == std::get<1>(serial_data));
+}
+
+TEST_CASE("FEATURE_STREAM")
+{
+    std::vector<std::string> paths = {
+        "bwv2.6.mid", "corrupt.mid", "bwv3.6.mid", "bwv2.6.mid", "bwv3.6.mid"};
+    std::vector<MIDI_SOURCE> sources(paths.begin(), paths.end());
+    auto feature_names = feature_tag_map["ALL"];
+    FusedExtractor extractor(feature_names);
+
+    for (const auto &num_threads : {1, 3}) {
+        FEATURE_STREAM stream(sources, feature_names, 0, false, num_threads, 1);
+        std::set<int> seen;
+        int index;
+        std::vector<std::unique_ptr<DISCRETE_DIST>> dists;
+        while (stream.next(index, dists)) {
+            REQUIRE(seen.insert(index).second);
+            Piece p(paths[index]);
+            auto expected = extractor(&p);
+            REQUIRE(dists.size() == expected.size());
+            for (size_t k=0; k<dists.size(); k++) {
+                REQUIRE(*dists[k] == *expected[k]);
+            }
+        }
+        REQUIRE(seen == std::set<int>({0,2,3,4}));
+        REQUIRE(!stream.next(index, dists));
+    }
+
+    // the workers stop if the stream is dropped early
+    {
+        FEATURE_STREAM stream(sources, feature_names, 0, false, 2, 1);
+        int index;
+        std::vector<std::unique_ptr<DISCRETE_DIST>> dists;
+        REQUIRE(stream.next(index, dists));
+    }
+}
+
+TEST_CASE("PROFILER")
+{
+    std::vector<std::string> paths = {
+        "bwv2.6.mid", "corrupt.mid", "bwv3.6.mid", "bwv2.6.mid", "bwv3.6.mid"};
+    std::vector<std::string> feature_names = {"ChordSize", "IntervalDist", "ChordTranRepeat"};
+
+    profiler.start(true);
+    Collector c;
+    extract_features(c, paths, feature_names, 0, false, 2);
+    c.getData(100);
+    // a call on another thread is not part of the profiled call
+    std::thread other([&]() {
+        Collector o;
+        extract_features(o, paths, feature_names, 0, false, 2);
+    });
+    other.join();
+    profiler.stop();
+    PROFILE_STATS stats = profiler.stats();
+
+    REQUIRE(stats.stages["extract"].calls == 1);
+    // corrupt.mid is empty, so it is rejected before it is read
+    REQUIRE(stats.stages["prescan"].calls == paths.size());
+    REQUIRE(stats.stages["read"].calls == paths.size() - 1);
+    REQUIRE(stats.rejected[REJECT_EMPTY] == 1);
+    REQUIRE(stats.stages["features"].items == 4);
+    REQUIRE(stats.stages["collect"].items == 4);
+    REQUIRE(stats.stages["notes"].items > 0);
+    REQUIRE(stats.stages["chords"].items > 0);
+#ifdef STYLE_RANK_COUNT_ALLOCATIONS
+    REQUIRE(stats.stages["chords"].allocations > 0);
+#else
+    REQUIRE(stats.stages["chords"].allocations == 0);
+#endif
+    REQUIRE(stats.stages["chords"].ns <= stats.stages["extract"].ns);
+    REQUIRE(stats.stages["matrix"].calls == feature_names.size());
+    REQUIRE(stats.threads >= 1);
+    REQUIRE(stats.dropped_events == 0);
+
+    // nothing is recorded while the profiler is stopped
+    extract_features(c, paths, feature_names, 0, false, 2);
+    REQUIRE(profiler.stats().stages["extract"].calls == 1);
+
+    char dir[] = "/tmp/style_rank_traceXXXXXX";
+    REQUIRE(mkdtemp(dir) != NULL);
+    std::string path = std::string(dir) + "/trace.json";
+    profiler.write_trace(path);
+    std::ifstream f(path);
+    std::string trace((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"chords\",\"ph\":\"X\"") != std::string::npos);
+    std::remove(path.c_str());
+    rmdir(dir);
+}
+
+TEST_CASE("COLLECTOR_MATRIX")
+{
+    Collector c;
+    for (uint64_t n : {1ull, 5ull, 1ull << 33}) {
+        auto d = sparse_dist();
+        (*d)[3] = n;
+        (*d)[7] = 2;
+        (*d)[11] = 1;
+        c.add("F", std::move(d));
+    }
+    auto data = c.getData(2);
+    auto domain = c.getDomain("F", 2);
+    REQUIRE(std::get<1>(data)["F"] == domain);
+    REQUIRE(std::get<0>(data)["F"].size() == 3 * (domain.size() + 1));
+
+    std::vector<uint32_t> narrow(std::get<0>(data)["F"].size());
+    std::vector<float> real(narrow.size());
+    c.getMatrix("F", domain, narrow.data());
+    c.getMatrix("F", domain, real.data());
+    for (int i=0; i<(int)narrow.size(); i++) {
+        uint64_t x = std::get<0>(data)["F"][i];
+        REQUIRE(narrow[i] == std::min<uint64_t>(x, UINT32_MAX));
+        REQUIRE(real[i] == (float)x);
+    }
+    // one count only fits in 64 bits
+    auto &wide = std::get<0>(data)["F"];
+    REQUIRE(*std::max_element(wide.begin(), wide.end()) == (1ull << 33));
+    REQUIRE(*std::max_element(narrow.begin(), narrow.end()) == UINT32_MAX);
+}
+
+TEST_CASE("SPACE_SAVING")
+{
+    // a zipf-like stream over 1000 keys, split in two halves
+    std::mt19937 rng(7);
+    std::vector<double> weights;
+    for (int k=1; k<=1000; k++) {
+        weights.push_back(1. / k);
+    }
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+    std::map<uint64_t,uint64_t> exact;
+    SPACE_SAVING a(50), b(50), whole(50);
+    for (int i=0; i<20000; i++) {
+        uint64_t key = zipf(rng);
+        exact[key]++;
+        whole.add(key);
+        (i % 2 ? a : b).add(key);
+    }
+    a.merge(b);
+    for (auto sketch : {&whole, &a}) {
+        REQUIRE(sketch->total() == 20000);
+        REQUIRE(sketch->evicted() > 0);
+        auto top = sketch->counters();
+        REQUIRE(top.size() == 50);
+        for (const auto &c : top) {
+            REQUIRE(c.count >= exact[c.key]);
+            REQUIRE(c.count - c.error <= exact[c.key]);
+            REQUIRE(c.error <= sketch->total() / 50);
+        }
+        // every key more frequent than the floor is monitored
+        for (const auto &kv : exact) {
+            if (kv.second > sketch->floor()) {
+                REQUIRE(std::any_of(top.begin(), top.end(), 
+                    [&](const SPACE_SAVING::COUNTER &c) { return c.key == kv.first; }));
+            }
+        }
+    }
+}
+
+TEST_CASE("STREAM_COLLECTOR")
+{
+    std::vector<std::string> paths = {
+        "bwv2.6.mid", "corrupt.mid", "bwv3.6.mid", "bwv2.6.mid", "bwv3.6.mid"};
+    auto feature_names = feature_tag_map["ALL"];
+
+    Collector exact;
+    auto exact_indices = extract_features(exact, paths, feature_names, 0, false, 2);
+    auto exact_data = exact.getData(100);
+
+    // without evictions the domains and rows are identical
+    STREAM_COLLECTOR large(100000);
+    auto large_indices = extract_features(large, paths, feature_names, 0, false, 2);
+    auto large_data = large.getData(100);
+    REQUIRE(large_indices == exact_indices);
+    REQUIRE(std::get<0>(large_data) == std::get<0>(exact_data));
+    REQUIRE(std::get<1>(large_data) == std::get<1>(exact_data));
+    for (const auto &name : feature_names) {
+        auto r = large.report(name, 100);
+        REQUIRE(r.evictions == 0);
+        REQUIRE(r.max_error == 0);
+        REQUIRE(r.guaranteed == r.domain_size);
+    }
+
+    // with evictions the rows are still exact counts over the chosen domain
+    STREAM_COLLECTOR small(8);
+    extract_features(small, paths, feature_names, 0, false, 2);
+    auto small_data = small.getData(4);
+    for (const auto &name : feature_names) {
+        auto domain = std::get<1>(small_data)[name];
+        std::vector<uint64_t> expected(exact.rows(name) * (domain.size() + 1));
+        exact.getMatrix(name, domain, expected.data());
+        REQUIRE(std::get<0>(small_data)[name] == expected);
+        auto r = small.report(name, 4);
+        REQUIRE(r.rows == exact_indices.size());
+        REQUIRE(r.guaranteed <= r.domain_size);
+        REQUIRE(r.max_error <= r.updates / 8);
+    }
+}
+
+TEST_CASE("VOCAB_COLLECTOR")
+{
+    std::vector<std::string> paths = {"bwv2.6.mid", "bwv3.6.mid"};
+    auto feature_names = feature_tag_map["ALL"];
+
+    Collector corpus;
+    extract_features(corpus, paths, feature_names, 0, false, 2);
+    auto corpus_data = corpus.getData(20);
+
+    // projecting a single new piece onto the frozen domains gives the
+    // row it has in the corpus
+    VOCAB_COLLECTOR frozen(std::get<1>(corpus_data));
+    auto indices = extract_features(frozen, {"bwv3.6.mid"}, feature_names, 0, false, 1);
+    REQUIRE(indices == std::vector<int>({0}));
+    auto frozen_data = frozen.getData(20);
+    REQUIRE(std::get<1>(frozen_data) == std::get<1>(corpus_data));
+    for (const auto &name : feature_names) {
+        auto &all = std::get<0>(corpus_data)[name];
+        std::vector<uint64_t> last(all.end() - all.size() / 2, all.end());
+        REQUIRE(std::get<0>(frozen_data)[name] == last);
+    }
+
+    REQUIRE_THROWS(frozen.add("NotAFeature", sparse_dist()));
+    REQUIRE_THROWS(VOCAB_COLLECTOR({{"F", {1, 2, 1}}}));
+}
+
+TEST_CASE("FOREST_LEAVES")
+{
+    // a single column that separates the classes perfectly
+    std::vector<float> X;
+    std::vector<int> y;
+    for (int i=0; i<60; i++) {
+        y.push_back(i % 3 == 0);
+        X.push_back((i % 3 == 0) ? 10 + i % 4 : i % 4);
+    }
+    std::vector<FOREST_DATA> data;
+    data.emplace_back(X.data(), 60, 1, y);
+
+    auto serial = forest_leaves(data, 20, 2, 7, 1);
+    auto parallel = forest_leaves(data, 20, 2, 7, 4);
+    REQUIRE(serial == parallel);
+
+    // classes never share a leaf
+    for (int t=0; t<20; t++) {
+        for (int i=0; i<60; i++) {
+            for (int j=0; j<60; j++) {
+                if (y[i] != y[j]) {
+                    REQUIRE(serial[0][i*20+t] != serial[0][j*20+t]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("FOREST_SPARSE_COLUMNS")
+{
+    // a sparse matrix with negative values, given densely and as a csr
+    // matrix with unsorted and duplicate entries
+    std::mt19937 rng(3);
+    size_t n = 80, d = 6;
+    std::vector<float> X(n * d, 0);
+    std::vector<int> y;
+    std::vector<float> data;
+    std::vector<int32_t> indices, indptr = {0};
+    for (size_t i=0; i<n; i++) {
+        y.push_back(rng() % 2);
+        for (int j=d-1; j>=0; j--) {
+            if (rng() % 3 == 0) {
+                float v = (int)(rng() % 7) - 3 + y.back();
+                X[i * d + j] = v;
+                data.push_back(v - 1);
+                indices.push_back(j);
+                data.push_back(1);
+                indices.push_back(j);
+            }
+        }
+        indptr.push_back(indices.size());
+    }
+    std::vector<FOREST_DATA> dense, csr;
+    dense.emplace_back(X.data(), n, d, y);
+    csr.emplace_back(data.data(), indices.data(), indptr.data(), n, d, y);
+    REQUIRE(csr[0].rows == dense[0].rows);
+    REQUIRE(csr[0].values == dense[0].values);
+    for (size_t i=0; i<n; i++) {
+        for (size_t j=0; j<d; j++) {
+            REQUIRE(dense[0].get(i, j) == X[i * d + j]);
+        }
+    }
+    for (const auto &v : dense[0].values) {
+        REQUIRE(v != 0);
+    }
+    REQUIRE(forest_leaves(dense, 20, 3, 5, 2) == forest_leaves(csr, 20, 3, 5, 2));
+}
+
+static void require_fused_matches(Piece *p)
+{
+    auto feature_names = feature_tag_map["ALL"];
+    FusedExtractor extractor(feature_names);
+    auto fused = extractor(p);
+    REQUIRE(fused.size() == feature_names.size());
+    for (int k=0; k<(int)feature_names.size(); k++) {
+        INFO(feature_names[k]);
+        REQUIRE(*fused[k] == *m[feature_names[k]](p));
+    }
+}
+
+TEST_CASE("CSR_MATCHES_DENSE")
+{
+    std::vector<std::string> paths = {"bwv2.6.mid", "bwv3.6.mid"};
+    auto feature_names = feature_tag_map["ALL"];
+
+    Collector exact;
+    extract_features(exact, paths, feature_names, 0, false, 2);
+    STREAM_COLLECTOR stream(100000);
+    extract_features(stream, paths, feature_names, 0, false, 2);
+    auto domains = std::get<1>(exact.getData(20));
+    VOCAB_COLLECTOR vocab(domains);
+    extract_features(vocab, paths, feature_names, 0, false, 2);
+
+    auto to_dense = [](const CSR_MATRIX<float> &csr, size_t width) {
+        std::vector<float> dense(csr.rows() * width, 0);
+        for (size_t i=0; i<csr.rows(); i++) {
+            for (int k=csr.indptr[i]; k<csr.indptr[i+1]; k++) {
+                REQUIRE(csr.data[k] != 0);
+                dense[i * width + csr.indices[k]] = csr.data[k];
+            }
+        }
+        return dense;
+    };
+    for (const auto &name : feature_names) {
+        INFO(name);
+        const auto &domain = domains[name];
+        std::vector<float> dense(exact.rows(name) * (domain.size() + 1));
+        exact.getMatrix(name, domain, dense.data());
+
+        CSR_MATRIX<float> a, b, c;
+        exact.getCSR(name, domain, a);
+        stream.getCSR(name, domain, b);
+        vocab.getCSR(name, domain, c);
+        REQUIRE(to_dense(a, domain.size() + 1) == dense);
+        REQUIRE(b.indptr == a.indptr);
+        REQUIRE(b.indices == a.indices);
+        REQUIRE(b.data == a.data);
+        REQUIRE(c.indptr == a.indptr);
+        REQUIRE(c.indices == a.indices);
+        REQUIRE(c.data == a.data);
+
+        // the forest sees the same matrix either way
+        std::vector<int> y = {0, 1};
+        FOREST_DATA from_dense(dense.data(), 2, domain.size() + 1, y);
+        FOREST_DATA from_csr(a.data.data(), a.indices.data(), a.indptr.data(), 2, domain.size() + 1, y);
+        REQUIRE(from_csr.colptr == from_dense.colptr);
+        REQUIRE(from_csr.rows == from_dense.rows);
+        REQUIRE(from_csr.values == from_dense.values);
+    }
+}
+
+TEST_CASE("FUSED_MATCHES_FEATURES")
+{
+    Piece *p = new Piece(example_notes);
+    require_fused_matches(p);
+    delete p;
+
+    for (const auto &path : {"bwv2.6.mid", "bwv3.6.mid"}) {
+        for (const auto &resolution : {0, 8}) {
+            for (const auto &include_offsets : {false, true}) {
+                p = new Piece(path, resolution, include_offsets);
+                require_fused_matches(p);
+                delete p;
+            }
+        }
+    }
+}
+
+TEST_CASE("PC_SETS")
+{
+    // the empty set, major and minor triads, the major scale, a cluster,
+    // the chromatic scale and a diminished seventh
+    std::vector<std::array<int,6>> sets = {
+        // mask, pcd, rot, size, scales, tonnetz
+        {{0x000, 0, 0, 0, 16777215, 0}},
+        {{0x091, 145, 0, 3, 196769, 2}},
+        {{0x089, 137, 0, 3, 595208, 2}},
+        {{0xab5, 1387, 1, 7, 1, 6}},
+        {{0x007, 7, 0, 3, 0, 4}},
+        {{0xfff, 4095, 0, 12, 0, 11}},
+        {{0x249, 585, 0, 4, 4792320, 3}}
+    };
+    for (const auto &x : sets) {
+        const PC_SET &s = pc_sets[x[0]];
+        REQUIRE(s.pcd == x[1]);
+        REQUIRE(s.rot == x[2]);
+        REQUIRE(s.size == x[3]);
+        REQUIRE(s.scales == (uint32_t)x[4]);
+        REQUIRE(s.tonnetz == x[5]);
+    }
+    for (int x=0; x<4096; x++) {
+        REQUIRE(rotate_pcs(x, pc_sets[x].rot) == pc_sets[x].pcd);
+        REQUIRE(pc_sets[pc_sets[x].pcd].tonnetz == pc_sets[x].tonnetz);
+    }
+}
+
+TEST_CASE("DISSONANCE_TABLE")
+{
+    for (int i=0; i<256; i++) {
+        const DISSONANCE_INTERVAL &x = dissonance_table.interval[i];
+        REQUIRE(x.frac == (double)x.num / x.den);
+        REQUIRE(dissonance_den(x.twos, x.odd) == (int)x.den);
+    }
+    // a fifth, a semitone, an octave below, and a minor seventh two octaves down
+    REQUIRE(dissonance_table.interval[128 + 7].num == 3);
+    REQUIRE(dissonance_table.interval[128 + 7].den == 2);
+    REQUIRE(dissonance_table.interval[128 + 1].num == 16);
+    REQUIRE(dissonance_table.interval[128 + 1].den == 15);
+    REQUIRE(dissonance_table.interval[128 - 12].num == 1);
+    REQUIRE(dissonance_table.interval[128 - 12].den == 2);
+    REQUIRE(dissonance_table.interval[128 - 14].num == 9);
+    REQUIRE(dissonance_table.interval[128 - 14].den == 20);
+
+    // the dyads of Stolzenburg (2015), by interval
+    std::vector<std::pair<int,int>> dyads = {
+        {0,1}, {12,1}, {7,2}, {5,3}, {4,4}, {9,3}, {8,5}, {3,5}, {6,6}, {10,7}, {2,8}, {11,8}, {1,15}};
+    for (const auto &dyad : dyads) {
+        std::vector<std::array<int,3>> notes = {{{60,0,1}}, {{60 + dyad.first,0,1}}};
+        Piece p(notes);
+        REQUIRE(periodicity(p.chords[0], ALL_NOTES, p.chords[0], ALL_NOTES) == dyad.second);
+    }
+
+    // the periodicity of random chords, against the lcm of the denominators
+    std::mt19937 rng(0);
+    for (int k=0; k<200; k++) {
+        std::vector<std::array<int,3>> notes;
+        int n = 1 + rng() % 12;
+        for (int i=0; i<n; i++) {
+            notes.push_back({{(int)(rng() % 128), (int)(rng() % 2), 2}});
+        }
+        Piece p(notes);
+        const CHORD &chord = p.chords.back();
+        double expected = 0;
+        for (int i=0; i<chord.size; i++) {
+            long long den_lcm = 1;
+            double min_frac = 1;
+            for (int j=0; j<chord.size; j++) {
+                const DISSONANCE_INTERVAL &x = dissonance_table.interval[chord.pitch[j] - chord.pitch[i] + 128];
+                min_frac = std::min(min_frac, (double)x.num / x.den);
+                long long a = den_lcm, b = x.den;
+                while (b) {
+                    long long t = a % b;
+                    a = b;
+                    b = t;
+                }
+                den_lcm = den_lcm / a * x.den;
+            }
+            expected += min_frac * den_lcm;
+        }
+        REQUIRE(periodicity(chord, ALL_NOTES, chord, ALL_NOTES) == (int)(expected / chord.size));
+    }
+}
+
+TEST_CASE("CHORD_MEMO")
+{
+    CHORD_MEMO &memo = CHORD_MEMO::local();
+    memo.clear();
+    Piece p("bwv2.6.mid");
+
+    // only the groups an extractor reads are computed
+    FusedExtractor shapes({"ChordShape"});
+    shapes(&p);
+    REQUIRE(memo.stats.lookups == p.chords.size());
+    REQUIRE(memo.size() < p.chords.size());
+    REQUIRE(memo.stats.hits == p.chords.size() - memo.size());
+    FusedExtractor intervals({"IntervalDist", "ChordShape"});
+    intervals(&p);
+    REQUIRE(memo.stats.hits == 2 * p.chords.size() - 2 * memo.size());
+
+    // every chord is found the second time, with the same values
+    auto a = intervals(&p);
+    REQUIRE(memo.stats.hits == 3 * p.chords.size() - 2 * memo.size());
+    REQUIRE(*a[0] == *m["IntervalDist"](&p));
+    REQUIRE(*a[1] == *m["ChordShape"](&p));
+    memo.clear();
+}
+
+TEST_CASE("DISCRETE_DIST")
+{
+    DISCRETE_DIST d(12);
+    d[3] += 2;
+    d[11]++;
+    d[12] += 5; // outside the dense domain
+    for (uint64_t k=0; k<1000; k++) {
+        d[(k << 40) + 7] += k; // forces the table to grow, k=0 stays absent
+    }
+    REQUIRE(d.size() == 3 + 999);
+    REQUIRE(d.find(3)->second == 2);
+    REQUIRE(d.find(12)->second == 5);
+    REQUIRE(d.find(0) == d.end());
+    REQUIRE(d.find(7) == d.end());
+    REQUIRE(d.find((500ULL << 40) + 7)->second == 500);
+
+    uint64_t total = 0;
+    for (const auto &kv : d) {
+        total += kv.second;
+    }
+    REQUIRE(total == 2 + 1 + 5 + 999 * 1000 / 2);
+
+    DISCRETE_DIST e;
+    for (const auto &kv : d) {
+        e[kv.first] = kv.second;
+    }
+    REQUIRE(e == d);
+    e[3]++;
+    REQUIRE(!(e == d));
+
+    // a standard forward iterator over (key, count) pairs, as the
+    // unordered_map it replaced
+    std::map<uint64_t,uint64_t> m(d.begin(), d.end());
+    REQUIRE(m.size() == d.size());
+    REQUIRE(m[12] == 5);
+    REQUIRE((size_t)std::distance(d.begin(), d.end()) == d.size());
+}
+
+static bool same_notes(const SMF_NOTES &a, const SMF_NOTES &b)
+{
+    return (a.ticks == b.ticks) && (a.track_count == b.track_count) &&
+        (a.pitch == b.pitch) && (a.onset == b.onset) &&
+        (a.duration == b.duration) && (a.velocity == b.velocity);
+}
+
+TEST_CASE("SMF_READER_MATCHES_MIDIFILE")
+{
+    for (const auto &path : {"bwv2.6.mid", "bwv3.6.mid"}) {
+        SMF_NOTES fast, slow;
+        MAPPED_FILE file(path);
+        REQUIRE(SMF_READER()(file.data, file.size, fast));
+        read_midifile_notes(path, slow);
+        REQUIRE(same_notes(fast, slow));
+    }
+
+    // running status, velocity 0 note-offs, a sysex, and two overlapping
+    // notes on the same key (the first note-off releases the second note-on)
+    std::vector<uint8_t> smf = {
+        'M','T','h','d', 0,0,0,6, 0,0, 0,1, 0,96,
+        'M','T','r','k', 0,0,0,0,
+        0, 0xf0, 2, 0x7e, 0xf7,
+        0, 0x90, 60, 100,
+        10, 62, 90,
+        10, 60, 80,
+        5, 60, 0,
+        5, 0x80, 60, 0,
+        0, 62, 0,
+        0, 0xff, 0x2f, 0
+    };
+    SMF_NOTES notes;
+    REQUIRE(SMF_READER()(smf.data(), smf.size(), notes));
+    REQUIRE(notes.ticks == 96);
+    REQUIRE(notes.pitch == std::vector<int>({60, 62, 60}));
+    REQUIRE(notes.onset == std::vector<int>({0, 10, 20}));
+    REQUIRE(notes.duration == std::vector<int>({30, 20, 5}));
+    REQUIRE(notes.velocity == std::vector<int>({100, 90, 80}));
+
+    // truncated files are left to midifile
+    smf.pop_back();
+    REQUIRE(!SMF_READER()(smf.data(), smf.size(), notes));
+    SMF_NOTES fallback;
+    REQUIRE(!read_smf_notes("corrupt.mid", fallback));
+}
+
+TEST_CASE("MEMORY_SOURCES")
+{
+    // midi files read in place match the same files read from disk,
+    // including one that is left to midifile
+    std::vector<std::string> paths = {"bwv2.6.mid", "corrupt.mid", "bwv3.6.mid"};
+    std::vector<std::vector<uint8_t>> files;
+    for (const auto &path : paths) {
+        std::ifstream input(path, std::ios::binary);
+        files.push_back(std::vector<uint8_t>(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()));
+        SMF_NOTES from_disk, from_memory;
+        REQUIRE(read_smf_notes(path, from_disk) == read_smf_notes(files.back().data(), files.back().size(), from_memory));
+        REQUIRE(same_notes(from_disk, from_memory));
+        read_midifile_notes(path, from_disk);
+        read_midifile_notes(files.back().data(), files.back().size(), from_memory);
+        REQUIRE(same_notes(from_disk, from_memory));
+    }
+
+    std::vector<MIDI_SOURCE> sources;
+    for (size_t i=0; i<paths.size(); i++) {
+        sources.push_back(MIDI_SOURCE(paths[i]));
+        sources.push_back(MIDI_SOURCE(files[i].data(), files[i].size()));
+    }
+    auto feature_names = feature_tag_map["ALL"];
+    Collector mixed;
+    auto indices = extract_features(mixed, sources, feature_names, 0, false, 2);
+    REQUIRE(indices == std::vector<int>({0,1,4,5}));
+    auto data = mixed.getData(100);
+    for (const auto &kv : std::get<0>(data)) {
+        size_t width = std::get<1>(data)[kv.first].size() + 1;
+        for (size_t i=0; i<indices.size(); i+=2) {
+            REQUIRE(std::equal(kv.second.begin() + i * width, kv.second.begin() + (i + 1) * width, kv.second.begin() + (i + 1) * width));
+        }
+    }
+}
+
+TEST_CASE("NOTE_ROWS")
+{
+    // notes given as rows match the midi files they were read from
+    std::vector<std::string> paths = {"bwv2.6.mid", "bwv3.6.mid"};
+    std::vector<int64_t> rows;
+    std::vector<size_t> offsets = {0};
+    int ticks = 0;
+    for (const auto &path : paths) {
+        SMF_NOTES smf;
+        read_smf_notes(path, smf);
+        REQUIRE(((ticks == 0) || (ticks == smf.ticks)));
+        ticks = smf.ticks;
+        for (size_t i=0; i<smf.size(); i++) {
+            rows.insert(rows.end(), {smf.pitch[i], smf.onset[i], smf.duration[i], smf.velocity[i]});
+        }
+        offsets.push_back(rows.size() / 4);
+    }
+    NOTE_ROWS notes = {rows.data(), rows.size() / 4, ticks};
+    auto feature_names = feature_tag_map["ALL"];
+    for (int resolution : {0, 8}) {
+        Collector from_rows, from_paths;
+        auto indices = extract_note_features(from_rows, notes, offsets, feature_names, resolution, false, 2);
+        REQUIRE(extract_features(from_paths, paths, feature_names, resolution, false, 2) == indices);
+        REQUIRE(indices == std::vector<int>({0,1}));
+        REQUIRE(std::get<0>(from_rows.getData(100)) == std::get<0>(from_paths.getData(100)));
+    }
 
+    std::vector<size_t> bad_offsets = {0, notes.size + 1};
+    Collector c;
+    REQUIRE_THROWS_AS(extract_note_features(c, notes, bad_offsets, feature_names, 0, false), std::invalid_argument);
+    rows[0] = 128;
+    REQUIRE_THROWS_AS(Piece(notes), std::invalid_argument);
+}
 
+TEST_CASE("PIANO_ROLL")
+{
+    // each run of frames is a note, so the two 62s that meet at frame 6
+    // of example_notes become one
+    std::vector<uint8_t> frames(8 * 128, 0);
+    for (const auto &note : example_notes) {
+        for (int t=note[1]; t<note[1]+note[2]; t++) {
+            frames[t * 128 + note[0]] = 1;
+        }
+    }
+    PIANO_ROLL roll = {frames.data(), 8, 1};
+    Piece p(roll);
+    REQUIRE(p.notes.size() == 9);
+    REQUIRE(p.notes.pitch[7] == 62);
+    REQUIRE(p.notes.onset[7] == 5);
+    REQUIRE(p.notes.duration[7] == 3);
+    REQUIRE(p.chords.size() == 6);
 
+    frames[0] = 200;
+    REQUIRE_THROWS_AS(Piece(roll), std::invalid_argument);
+}
 
+// a midi file of (pitch, onset, duration) notes on one channel
+static std::vector<uint8_t> midi_bytes(const std::vector<std::array<int,3>> &notes, int channel)
+{
+    smf::MidiFile midifile;
+    for (const auto &note : notes) {
+        midifile.addNoteOn(0, note[1], channel, note[0], 80);
+        midifile.addNoteOff(0, note[1] + note[2], channel, note[0]);
+    }
+    midifile.sortTracks();
+    std::ostringstream out;
+    midifile.write(out);
+    std::string s = out.str();
+    return std::vector<uint8_t>(s.begin(), s.end());
+}
+
+TEST_CASE("PRESCAN")
+{
+    // the prescan never rejects a file that would have been featurized
+    std::mt19937 rng(0);
+    FusedExtractor extractor({"ChordSize"});
+    int rejected = 0;
+    for (int i=0; i<300; i++) {
+        std::vector<std::array<int,3>> notes;
+        int n = rng() % 24;
+        for (int k=0; k<n; k++) {
+            notes.push_back({{48 + (int)(rng() % 24), (int)(rng() % 16) * 120, 1 + (int)(rng() % 4) * 120}});
+        }
+        auto midi = midi_bytes(notes, 0);
+        for (int resolution : {0, 4}) {
+            for (bool include_offsets : {false, true}) {
+                Piece p(midi.data(), midi.size(), resolution, include_offsets);
+                std::vector<std::unique_ptr<DISCRETE_DIST>> dists;
+                bool valid = featurize_piece(&p, extractor, dists);
+                bool kept = prescan(midi.data(), midi.size(), include_offsets, false);
+                REQUIRE((kept || !valid));
+                rejected += !kept;
+            }
+        }
+    }
+    REQUIRE(rejected > 0);
+
+    // drum-only files are only rejected when asked to
+    std::vector<std::array<int,3>> notes;
+    for (int k=0; k<50; k++) {
+        notes.push_back({{36 + k % 3, k * 60, 60}});
+    }
+    auto drums = midi_bytes(notes, 9);
+    auto piano = midi_bytes(notes, 0);
+    REQUIRE(prescan(drums.data(), drums.size(), false, false));
+    REQUIRE(!prescan(drums.data(), drums.size(), false, true));
+    REQUIRE(prescan(piano.data(), piano.size(), false, true));
+
+    std::vector<MIDI_SOURCE> sources = {
+        MIDI_SOURCE(drums.data(), drums.size()), MIDI_SOURCE(piano.data(), piano.size()), MIDI_SOURCE("corrupt.mid")};
+    profiler.start();
+    Collector c;
+    REQUIRE(extract_features(c, sources, {"ChordSize"}, 0, false, 1) == std::vector<int>({0,1}));
+    REQUIRE(extract_features(c, sources, {"ChordSize"}, 0, false, 1, nullptr, nullptr, nullptr, true) == std::vector<int>({1}));
+    profiler.stop();
+    PROFILE_STATS stats = profiler.stats();
+    REQUIRE(stats.rejected[REJECT_DRUM_ONLY] == 1);
+    REQUIRE(stats.rejected[REJECT_EMPTY] == 2);
+}
+
+static void remove_cache_dir(const char *dir)
+{
+    DIR *d = opendir(dir);
+    while (struct dirent *ent = readdir(d)) {
+        if (ent->d_name[0] != '.') {
+            remove((std::string(dir) + "/" + ent->d_name).c_str());
+        }
+    }
+    closedir(d);
+    rmdir(dir);
+}
+
+TEST_CASE("PIECE_CACHE")
+{
+    auto feature_names = feature_tag_map["ALL"];
+    FusedExtractor extractor(feature_names);
+
+    for (const auto &store_chords : {true, false}) {
+        char dir[] = "/tmp/style_rank_cacheXXXXXX";
+        REQUIRE(mkdtemp(dir) != NULL);
+        PIECE_CACHE cache(dir, 1 << 30, store_chords);
+        for (int pass=0; pass<2; pass++) {
+            for (const auto &resolution : {0, 8}) {
+                for (const auto &include_offsets : {false, true}) {
+                    Piece p("bwv2.6.mid", resolution, include_offsets);
+                    auto cached = cache.get("bwv2.6.mid", resolution, include_offsets);
+                    REQUIRE(cached->chords.size() == p.chords.size());
+                    auto a = extractor(&p);
+                    auto b = extractor(cached.get());
+                    for (int k=0; k<(int)feature_names.size(); k++) {
+                        INFO(feature_names[k]);
+                        REQUIRE(*a[k] == *b[k]);
+                    }
+                }
+            }
+        }
+        REQUIRE(cache.stats.misses == 4);
+        REQUIRE(cache.stats.hits == 4);
+        REQUIRE(cache.stats.writes == 4);
+        remove_cache_dir(dir);
+    }
+
+    // a cache smaller than one entry evicts on every write
+    char dir[] = "/tmp/style_rank_cacheXXXXXX";
+    REQUIRE(mkdtemp(dir) != NULL);
+    PIECE_CACHE tiny(dir, 1);
+    tiny.get("bwv2.6.mid", 0, false);
+    tiny.get("bwv3.6.mid", 0, false);
+    REQUIRE(tiny.stats.misses == 2);
+    REQUIRE(tiny.stats.evictions == 2);
+    REQUIRE(tiny.stats.bytes == 0);
+    remove_cache_dir(dir);
+}
+
+static void copy_file(const std::string &from, const std::string &to)
+{
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary);
+    out << in.rdbuf();
+}
+
+TEST_CASE("FEATURE_STORE")
+{
+    auto feature_names = feature_tag_map["ALL"];
+    char dir[] = "/tmp/style_rank_storeXXXXXX";
+    REQUIRE(mkdtemp(dir) != NULL);
+    std::string copy = std::string(dir) + "/copy.mid";
+    copy_file("bwv3.6.mid", copy);
+    std::vector<std::string> paths = {"bwv2.6.mid", "corrupt.mid", copy};
+
+    Collector expected;
+    auto expected_indices = extract_features(expected, paths, feature_names, 0, false, 2);
+    auto expected_data = expected.getData(100);
+
+    // two processes append to the same store at once
+    std::vector<std::vector<std::string>> halves = {
+        std::vector<std::string>(feature_names.begin(), feature_names.begin() + 10),
+        std::vector<std::string>(feature_names.begin() + 10, feature_names.end())};
+    std::vector<pid_t> children;
+    for (const auto &names : halves) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            FEATURE_STORE store(dir);
+            Collector c;
+            extract_features(c, paths, names, 0, false, 2, nullptr, &store);
+            _exit(0);
+        }
+        children.push_back(pid);
+    }
+    for (auto pid : children) {
+        int status;
+        waitpid(pid, &status, 0);
+        REQUIRE(WIFEXITED(status));
+    }
+
+    // the halves are stored as separate records, so at least one of them
+    // is missing the other half's features. the first pass fills them in.
+    FEATURE_STORE store(dir);
+    for (int pass=0; pass<2; pass++) {
+        Collector c;
+        auto indices = extract_features(c, paths, feature_names, 0, false, 2, nullptr, &store);
+        REQUIRE(indices == expected_indices);
+        auto data = c.getData(100);
+        REQUIRE(std::get<0>(data) == std::get<0>(expected_data));
+        REQUIRE(std::get<1>(data) == std::get<1>(expected_data));
+    }
+    REQUIRE(store.stats.hits >= 3);
+    REQUIRE(store.stats.records == 3);
+
+    // a changed file is featurized again, and compaction drops its old
+    // records along with the superseded ones
+    struct utimbuf times = {1000000, 1000000};
+    REQUIRE(utime(copy.c_str(), &times) == 0);
+    uint64_t appends = store.stats.appends;
+    Collector c;
+    extract_features(c, paths, feature_names, 0, false, 2, nullptr, &store);
+    REQUIRE(store.stats.appends == appends + 1);
+    store.refresh();
+    REQUIRE(store.stats.records == 4);
+    long long before = store.stats.bytes;
+    REQUIRE(store.compact() > 0);
+    REQUIRE(store.stats.records == 3);
+    REQUIRE(store.stats.bytes < before);
+
+    // and everything is still a hit
+    uint64_t hits = store.stats.hits;
+    Collector compacted;
+    extract_features(compacted, paths, feature_names, 0, false, 2, nullptr, &store);
+    REQUIRE(store.stats.hits == hits + 3);
+    REQUIRE(std::get<0>(compacted.getData(100)) == std::get<0>(expected_data));
+
+    remove_cache_dir(dir);
+}
+
+static std::vector<uint8_t> read_file(const std::string &path)
+{
+    std::ifstream input(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+}
+
+static void put_le(std::string &out, uint64_t x, int n)
+{
+    for (int i=0; i<n; i++) out += (char)((x >> (8 * i)) & 0xff);
+}
+
+// a zip of (name, data) members, deflated when deflated is set
+static void write_zip(const std::string &path, const std::vector<std::pair<std::string,std::vector<uint8_t>>> &members, bool deflated)
+{
+    std::string out, directory;
+    for (const auto &m : members) {
+        std::vector<uint8_t> data = m.second;
+        if (deflated) {
+            z_stream s;
+            memset(&s, 0, sizeof(s));
+            REQUIRE(deflateInit2(&s, 9, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+            data.resize(deflateBound(&s, m.second.size()));
+            s.next_in = (Bytef*)m.second.data();
+            s.avail_in = m.second.size();
+            s.next_out = data.data();
+            s.avail_out = data.size();
+            REQUIRE(deflate(&s, Z_FINISH) == Z_STREAM_END);
+            data.resize(s.total_out);
+            deflateEnd(&s);
+        }
+        uint32_t crc = crc32(0, m.second.data(), m.second.size());
+        std::string common;
+        put_le(common, 20, 2);
+        put_le(common, 0, 2);
+        put_le(common, deflated ? 8 : 0, 2);
+        put_le(common, 0, 4);
+        put_le(common, crc, 4);
+        put_le(common, data.size(), 4);
+        put_le(common, m.second.size(), 4);
+        put_le(common, m.first.size(), 2);
+        put_le(common, 0, 2);
+        put_le(directory, 0x02014b50, 4);
+        put_le(directory, 20, 2);
+        directory += common;
+        put_le(directory, 0, 6);
+        put_le(directory, 0, 4);
+        put_le(directory, out.size(), 4);
+        directory += m.first;
+        put_le(out, 0x04034b50, 4);
+        out += common;
+        out += m.first;
+        out.append(data.begin(), data.end());
+    }
+    size_t offset = out.size();
+    out += directory;
+    put_le(out, 0x06054b50, 4);
+    put_le(out, 0, 4);
+    put_le(out, members.size(), 2);
+    put_le(out, members.size(), 2);
+    put_le(out, directory.size(), 4);
+    put_le(out, offset, 4);
+    put_le(out, 0, 2);
+    std::ofstream(path, std::ios::binary) << out;
+}
+
+// a ustar archive of (name, data) members, gzipped if path ends in .gz
+static void write_tar(const std::string &path, const std::vector<std::pair<std::string,std::vector<uint8_t>>> &members)
+{
+    std::string out;
+    for (const auto &m : members) {
+        char header[512] = {0};
+        strncpy(header, m.first.c_str(), 99);
+        snprintf(header + 100, 8, "%07o", 0644);
+        snprintf(header + 124, 12, "%011lo", (unsigned long)m.second.size());
+        header[156] = '0';
+        memcpy(header + 257, "ustar", 6);
+        memcpy(header + 263, "00", 2);
+        memset(header + 148, ' ', 8);
+        unsigned sum = 0;
+        for (int i=0; i<512; i++) sum += (unsigned char)header[i];
+        snprintf(header + 148, 8, "%06o", sum);
+        out.append(header, 512);
+        out.append(m.second.begin(), m.second.end());
+        out.append((512 - m.second.size() % 512) % 512, '\0');
+    }
+    out.append(1024, '\0');
+    if (path.size() > 3 && path.compare(path.size() - 3, 3, ".gz") == 0) {
+        gzFile gz = gzopen(path.c_str(), "wb");
+        gzwrite(gz, out.data(), out.size());
+        gzclose(gz);
+    }
+    else {
+        std::ofstream(path, std::ios::binary) << out;
+    }
+}
+
+TEST_CASE("ARCHIVES")
+{
+    // the midi files in an archive match the same files read from disk,
+    // and the other members are skipped
+    std::vector<std::string> paths = {"bwv2.6.mid", "corrupt.mid", "bwv3.6.mid"};
+    std::vector<std::pair<std::string,std::vector<uint8_t>>> members;
+    for (const auto &path : paths) {
+        members.push_back(std::make_pair("corpus/" + path, read_file(path)));
+    }
+    members.insert(members.begin() + 1, std::make_pair("corpus/README.txt", std::vector<uint8_t>(1000, 'x')));
+
+    auto feature_names = feature_tag_map["ALL"];
+    Collector expected;
+    std::vector<std::string> expected_paths = {"bwv2.6.mid", "bwv2.6.mid", "bwv3.6.mid", "bwv3.6.mid"};
+    extract_features(expected, expected_paths, feature_names, 0, false, 2);
+    auto expected_data = expected.getData(100);
+
+    char dir[] = "/tmp/style_rank_archiveXXXXXX";
+    REQUIRE(mkdtemp(dir) != NULL);
+    std::vector<std::string> archives = {
+        std::string(dir) + "/stored.zip", std::string(dir) + "/deflated.zip", 
+        std::string(dir) + "/corpus.tar", std::string(dir) + "/corpus.tar.gz"};
+    write_zip(archives[0], members, false);
+    write_zip(archives[1], members, true);
+    write_tar(archives[2], members);
+    write_tar(archives[3], members);
+
+    for (const auto &archive : archives) {
+        INFO(archive);
+        std::vector<MIDI_SOURCE> sources = {MIDI_SOURCE("bwv2.6.mid"), MIDI_SOURCE(archive), MIDI_SOURCE("bwv3.6.mid")};
+        Collector c;
+        std::vector<std::string> names;
+        auto indices = extract_features(c, sources, feature_names, 0, false, 2, nullptr, nullptr, &names);
+        REQUIRE(indices == std::vector<int>({0,1,1,2}));
+        REQUIRE(names == std::vector<std::string>({"", "corpus/bwv2.6.mid", "corpus/bwv3.6.mid", ""}));
+        auto data = c.getData(100);
+        REQUIRE(std::get<0>(data) == std::get<0>(expected_data));
+        REQUIRE(std::get<1>(data) == std::get<1>(expected_data));
+    }
+
+    std::ofstream(std::string(dir) + "/bad.zip") << "not a zip";
+    Collector c;
+    REQUIRE_THROWS_AS(extract_features(c, std::vector<std::string>({std::string(dir) + "/bad.zip"}), feature_names, 0, false), std::runtime_error);
+    REQUIRE_THROWS_AS(FEATURE_STREAM(std::vector<MIDI_SOURCE>({MIDI_SOURCE(archives[0])}), feature_names, 0, false), std::invalid_argument);
+
+    remove_cache_dir(dir);
+}
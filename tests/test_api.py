@@ -4,11 +4,13 @@ import tempfile
 import warnings
 import collections
 import numpy as np
+import scipy.sparse
 import pandas as pd
 from subprocess import call
 from itertools import zip_longest, product
 
 import style_rank as sr
+import style_rank.api
 
 import unittest
 from parameterized import parameterized
@@ -28,6 +30,7 @@ params = collections.OrderedDict([
     ("feature_names", features_name_subsets + [[]] + [feature_names]),
     ("resolution", [0,8]),
     ("include_offsets", [False,True]),
+    ("num_threads", [1,0]),
     ("rank_set", [midi_paths]),
     ("style_set", [midi_paths[::-1]]),
     ("n_estimators", [10]),
@@ -53,7 +56,7 @@ class TestGetFeatureNames(unittest.TestCase):
     self.assertTrue(type(sr.get_feature_names(*args))==list)
 
 class TestGetFeatures(unittest.TestCase):
-  @parameterized.expand(build_param_sets(["paths"], ["upper_bound", "feature_names", "resolution", "include_offsets"], "get_features"))
+  @parameterized.expand(build_param_sets(["paths"], ["upper_bound", "feature_names", "resolution", "include_offsets", "num_threads"], "get_features"))
   def test_sequence(self, name, args, kwargs):
       output,_,_ = sr.get_features(*args,**kwargs)
       if len(kwargs["feature_names"]) > 0:
@@ -106,6 +109,272 @@ class TestRank(unittest.TestCase):
       output = sr.rank(*args,**kwargs)
       self.assertTrue(len(output) == len(args[0]), "length")
 
+class TestLeafStyleScores(unittest.TestCase):
+  def test(self):
+    rng = np.random.RandomState(0)
+    labels = np.array([0]*30 + [1]*20)
+    leaves = rng.randint(8, size=(len(labels),10))
+    sim_mat = sr.api.leaf_similarity(leaves)
+    expected = sim_mat[labels==0][:,labels==1].sum(1)
+    scores = sr.api.leaf_style_scores(leaves, labels)
+    self.assertTrue(np.allclose(scores, expected))
+
+class TestFeatureDtype(unittest.TestCase):
+  @parameterized.expand([[d] for d in ["uint64", "uint32", "float32"]])
+  def test(self, dtype):
+    expected,domains,_ = sr.get_features(midi_paths, feature_names=feature_names)
+    output,_,_ = sr.get_features(midi_paths, feature_names=feature_names, dtype=dtype)
+    for k in feature_names:
+      self.assertEqual(output[k].dtype, np.dtype(dtype), k)
+      self.assertEqual(output[k].shape, (len(midi_paths), len(domains[k])+1), k)
+      self.assertTrue(output[k].flags["C_CONTIGUOUS"], k)
+      self.assertTrue(np.array_equal(output[k], expected[k].astype(dtype)), k)
+
+  def test_invalid(self):
+    with self.assertRaises(ValueError):
+      sr.get_features(midi_paths, dtype="int8")
+
+class TestStreaming(unittest.TestCase):
+  def test(self):
+    exact,exact_domains,_ = sr.get_features(midi_paths, upper_bound=100, feature_names=feature_names)
+    output,domains,_ = sr.get_features(midi_paths, upper_bound=100, feature_names=feature_names, sketch_size=100000)
+    report = sr.stream_report()
+    for k in feature_names:
+      self.assertTrue(np.array_equal(exact_domains[k], domains[k]), k)
+      self.assertTrue(np.array_equal(exact[k], output[k]), k)
+      self.assertEqual(report[k]["evictions"], 0, k)
+      self.assertEqual(report[k]["guaranteed"], len(domains[k]), k)
+
+  def test_invalid(self):
+    with self.assertRaises(ValueError):
+      sr.get_features(midi_paths, upper_bound=100, sketch_size=10)
+
+class TestSparse(unittest.TestCase):
+  def test(self):
+    dense,_,_ = sr.get_features(midi_paths, feature_names=feature_names)
+    output,domains,_ = sr.get_features(midi_paths, feature_names=feature_names, sparse=True, dtype="uint32")
+    for k in feature_names:
+      self.assertTrue(scipy.sparse.isspmatrix_csr(output[k]), k)
+      self.assertEqual(output[k].shape, (len(midi_paths), len(domains[k])+1), k)
+      self.assertTrue(np.array_equal(output[k].toarray(), dense[k]), k)
+
+  def test_rank(self):
+    features,_,_ = sr.get_features(midi_paths*10, feature_names=feature_names)
+    sparse_features = {k : scipy.sparse.csr_matrix(v) for k,v in features.items()}
+    style = midi_paths*5
+    with warnings.catch_warnings():
+      warnings.simplefilter("ignore")
+      np.random.seed(0)
+      expected = sr.rank(style, style, raw_features=features, n_estimators=10, max_depth=2, return_similarity=True)
+      np.random.seed(0)
+      output = sr.rank(style, style, raw_features=sparse_features, n_estimators=10, max_depth=2, return_similarity=True)
+    self.assertEqual([s for _,s in output], [s for _,s in expected])
+
+class TestVocabulary(unittest.TestCase):
+  def test(self):
+    path = temp_name + ".json"
+    try:
+      corpus,domains,_ = sr.get_features(midi_paths, upper_bound=100, feature_names=feature_names)
+      sr.save_vocabulary(path, domains)
+      vocabulary = sr.load_vocabulary(path)
+      self.assertSetEqual(set(vocabulary["domains"].keys()), set(domains.keys()))
+
+      # a new piece is projected onto the corpus columns
+      for v in [path, vocabulary]:
+        output,output_domains,indices = sr.get_features(midi_paths[1:], vocabulary=v)
+        self.assertEqual(list(indices), [0])
+        for k in feature_names:
+          self.assertTrue(np.array_equal(output_domains[k], domains[k]), k)
+          self.assertTrue(np.array_equal(output[k], corpus[k][1:]), k)
+
+      with self.assertRaises(ValueError):
+        sr.get_features(midi_paths, vocabulary=path, resolution=8)
+      vocabulary["version"] += 1
+      with open(path, "w") as f:
+        json.dump(vocabulary, f)
+      with self.assertRaises(ValueError):
+        sr.load_vocabulary(path)
+    finally:
+      call(["rm", "-f", path])
+
+class TestCache(unittest.TestCase):
+  def test(self):
+    cache_dir = tempfile.mkdtemp()
+    try:
+      cold = sr.get_features(midi_paths, feature_names=feature_names)
+      sr.enable_cache(cache_dir)
+      sr.get_features(midi_paths, feature_names=feature_names)
+      warm = sr.get_features(midi_paths, feature_names=feature_names)
+      stats = sr.cache_stats()
+      self.assertEqual(stats["misses"], len(midi_paths))
+      self.assertEqual(stats["hits"], len(midi_paths))
+      for k in feature_names:
+        self.assertTrue(np.array_equal(cold[0][k], warm[0][k]), k)
+    finally:
+      sr.disable_cache()
+      call(["rm", "-rf", cache_dir])
+
+class TestFeatureStore(unittest.TestCase):
+  def test(self):
+    store_dir = tempfile.mkdtemp()
+    try:
+      cold = sr.get_features(midi_paths, feature_names=feature_names)
+      sr.enable_feature_store(store_dir)
+      sr.get_features(midi_paths, feature_names=feature_names)
+      warm = sr.get_features(midi_paths, feature_names=feature_names)
+      stats = sr.feature_store_stats()
+      self.assertEqual(stats["misses"], len(midi_paths))
+      self.assertEqual(stats["hits"], len(midi_paths))
+      self.assertEqual(stats["records"], len(midi_paths))
+      for k in feature_names:
+        self.assertTrue(np.array_equal(cold[0][k], warm[0][k]), k)
+      self.assertEqual(sr.compact_feature_store(), 0)
+    finally:
+      sr.disable_feature_store()
+      call(["rm", "-rf", store_dir])
+
+class TestMemoryInput(unittest.TestCase):
+  def test(self):
+    fs, domains, indices = sr.get_features(midi_paths, feature_names=feature_names)
+    data = []
+    for path in midi_paths:
+      with open(path, "rb") as f:
+        data.append(f.read())
+    for inputs in [data, [memoryview(x) for x in data], [bytearray(data[0]), midi_paths[1]]]:
+      fs_mem, domains_mem, indices_mem = sr.get_features(inputs, feature_names=feature_names)
+      self.assertTrue(np.array_equal(indices, indices_mem))
+      for k in feature_names:
+        self.assertTrue(np.array_equal(fs[k], fs_mem[k]), k)
+        self.assertTrue(np.array_equal(domains[k], domains_mem[k]), k)
+
+  def test_single(self):
+    with open(midi_paths[0], "rb") as f:
+      fs, _, indices = sr.get_features(f.read(), feature_names=feature_names)
+    self.assertEqual(list(indices), [0])
+
+class TestNoteInput(unittest.TestCase):
+  def notes(self, steps, seed):
+    # three voices in steps of 2 ticks, never repeating a pitch from one
+    # step to the next, so the notes are also a piano roll
+    return np.array([[48 + 12 * k + (i * 5 + k + seed) % 7, 2 * i, 2, 80] for i in range(steps) for k in range(3)], dtype=np.int64)
+
+  def test(self):
+    pieces = [self.notes(40, 0), self.notes(3, 1), self.notes(60, 2)]
+    offsets = np.cumsum([0] + [len(x) for x in pieces])
+    fs, domains, indices = sr.get_note_features(np.concatenate(pieces), offsets, ticks_per_beat=2, feature_names=feature_names)
+    self.assertEqual(list(indices), [0,2])
+    fs_list, _, indices_list = sr.get_note_features(pieces, ticks_per_beat=2, feature_names=feature_names, num_threads=2)
+    self.assertEqual(list(indices_list), [0,2])
+    rolls = []
+    for x in pieces:
+      roll = np.zeros((x[:,1].max() + 2, 128), dtype=bool)
+      for pitch, onset, duration, _ in x:
+        roll[onset:onset+duration,pitch] = True
+      rolls.append(roll)
+    fs_roll, domains_roll, indices_roll = sr.get_note_features(rolls, ticks_per_beat=2, piano_roll=True, feature_names=feature_names)
+    self.assertEqual(list(indices_roll), [0,2])
+    for k in feature_names:
+      self.assertTrue(np.array_equal(fs[k], fs_list[k]), k)
+      self.assertTrue(np.array_equal(fs[k], fs_roll[k]), k)
+      self.assertTrue(np.array_equal(domains[k], domains_roll[k]), k)
+
+  def test_invalid(self):
+    notes = self.notes(20, 0)
+    with self.assertRaises(ValueError):
+      sr.get_note_features(notes[:,:3])
+    with self.assertRaises(ValueError):
+      sr.get_note_features(notes, [0, 10])
+    with self.assertRaises(ValueError):
+      sr.get_note_features(notes.astype(np.float32))
+    notes[5,0] = 128
+    with self.assertRaises(ValueError):
+      sr.get_note_features(notes)
+
+class TestArchive(unittest.TestCase):
+  def test(self):
+    import zipfile, tarfile
+    fs, domains, _ = sr.get_features(midi_paths + midi_paths, feature_names=feature_names)
+    archive_dir = tempfile.mkdtemp()
+    try:
+      archives = [os.path.join(archive_dir, name) for name in ["corpus.zip", "corpus.tar", "corpus.tar.gz"]]
+      with zipfile.ZipFile(archives[0], "w", zipfile.ZIP_DEFLATED) as z:
+        for path in midi_paths:
+          z.write(path, "corpus/" + path)
+        z.writestr("corpus/README.txt", "not a midi")
+      for archive, mode in zip(archives[1:], ["w", "w:gz"]):
+        with tarfile.open(archive, mode) as t:
+          for path in midi_paths:
+            t.add(path, "corpus/" + path)
+      for archive in archives:
+        fs_archive, domains_archive, indices, names = sr.get_features([midi_paths[0], archive, midi_paths[1]], feature_names=feature_names, return_names=True)
+        self.assertEqual(list(indices), [0,1,1,2])
+        self.assertEqual(names, [midi_paths[0], archive + "/corpus/" + midi_paths[0], archive + "/corpus/" + midi_paths[1], midi_paths[1]])
+        rows = [0,2,3,1]
+        for k in feature_names:
+          self.assertTrue(np.array_equal(fs[k][rows], fs_archive[k]), k)
+          self.assertTrue(np.array_equal(domains[k], domains_archive[k]), k)
+      sr.get_feature_csv([archives[0]], archive_dir, feature_names=feature_names[:1])
+      csv = pd.read_csv(os.path.join(archive_dir, feature_names[0] + ".csv"))
+      self.assertEqual(list(csv["filepath"]), [archives[0] + "/corpus/" + path for path in midi_paths])
+      with self.assertRaises(ValueError):
+        list(sr.iter_features([archives[0]]))
+
+      # each midi in an archive is ranked under a name of its own
+      json_path = os.path.join(archive_dir, "ranks.json")
+      ranked = sr.rank([archives[0]], midi_paths, feature_names=feature_names, n_estimators=10, max_depth=2, json_path=json_path)
+      expected = [archives[0] + "/corpus/" + path for path in midi_paths]
+      self.assertEqual(len(set(ranked)), len(midi_paths))
+      self.assertEqual(sorted(ranked), sorted(expected))
+      with open(json_path) as f:
+        self.assertEqual(sorted(json.load(f).keys()), sorted(expected))
+    finally:
+      call(["rm", "-rf", archive_dir])
+
+class TestIterFeatures(unittest.TestCase):
+  def test(self):
+    paths = midi_paths * 3
+    fs, domains, indices = sr.get_features(paths, feature_names=feature_names)
+    rows = {i : r for r,i in enumerate(indices)}
+    seen = set()
+    for index, hists in sr.iter_features(paths, feature_names=feature_names, num_threads=2, queue_size=1):
+      seen.add(index)
+      for k in feature_names:
+        self.assertEqual(sum(hists[k].values()), fs[k][rows[index]].sum(), k)
+        domain = list(domains[k])
+        for value, count in hists[k].items():
+          if value in domain:
+            self.assertEqual(count, fs[k][rows[index], domain.index(value)])
+    self.assertEqual(seen, set(indices))
+
+  def test_close(self):
+    it = sr.iter_features(midi_paths * 10, feature_names=feature_names, queue_size=1)
+    next(it)
+    it.close()
+
+class TestProfile(unittest.TestCase):
+  def test(self):
+    trace_dir = tempfile.mkdtemp()
+    trace_path = os.path.join(trace_dir, "trace.json")
+    try:
+      fs, domains, indices, stats = sr.get_features(midi_paths, feature_names=feature_names, num_threads=2, return_stats=True, trace_path=trace_path)
+      self.assertEqual(stats["pieces"], len(midi_paths))
+      self.assertGreater(stats["notes"], 0)
+      self.assertGreater(stats["chords"], 0)
+      self.assertEqual(stats["stages"]["read"]["calls"], len(midi_paths))
+      self.assertEqual(stats["stages"]["extract"]["calls"], 1)
+      self.assertEqual(stats["stages"]["prescan"]["calls"], len(midi_paths))
+      self.assertEqual(set(stats["rejected"]), {"empty", "too_few_onsets", "drum_only", "too_few_chords"})
+      self.assertEqual(sum(stats["rejected"].values()), 0)
+      self.assertGreater(stats["chord_memo"]["hits"], 0)
+      self.assertLessEqual(stats["chord_memo"]["hits"], stats["chord_memo"]["lookups"])
+      with open(trace_path) as f:
+        trace = json.load(f)
+      names = set(e["name"] for e in trace["traceEvents"])
+      self.assertTrue({"read", "chords", "features"} <= names)
+      self.assertEqual(len(sr.get_features(midi_paths, feature_names=feature_names)), 3)
+    finally:
+      call(["rm", "-rf", trace_dir])
+
 # test that it fails on corrupt input
 class TestRankOnCorrupt(unittest.TestCase):
   def test(self):